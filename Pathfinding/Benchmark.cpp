@@ -0,0 +1,1114 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       Benchmark.cpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+///
+/// Build  : g++ -std=c++14 -O2 -pthread Benchmark.cpp CWorkStealingPool.cpp CMappedFile.cpp ../StackAllocator/CStackAllocator.cpp
+///          add -mavx2 for the AVX2 kernels of TBitGrid, SSE2 otherwise on x86-64
+/// Usage  : ./a.out [benchmark name]
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+#if defined(__linux__)
+#   include <unistd.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <linux/perf_event.h>
+#endif
+
+#include "TMapFile.hpp"
+#include "TBitGrid.hpp"
+#include "TSquareGrid.hpp"
+#include "TStaticSquareGrid.hpp"
+#include "TMappedGrid.hpp"
+#include "TCompactGrid.hpp"
+#include "TChunkedGrid.hpp"
+#include "TFlowField.hpp"
+#include "TFirstMoveTable.hpp"
+#include "TSearchStats.hpp"
+#include "TLandmarkTable.hpp"
+#include "TSearchScheduler.hpp"
+#include "THashDistributedSearch.hpp"
+#include "TPathfinding.hpp"
+#include "TArenaAllocator.hpp"
+#include "CWorkStealingPool.hpp"
+#include "../StackAllocator/CStackAllocator.hpp"
+
+// Alias to make the code more readable
+using CoordinateType = short;
+using PriorityType   = int;
+using TTNode         = nav::TNode        <CoordinateType, PriorityType>;
+using TTSquareGrid   = nav::TSquareGrid  <CoordinateType, PriorityType>;
+using TTMappedGrid   = nav::TMappedGrid  <CoordinateType, PriorityType>;
+using TTCompactGrid  = nav::TCompactGrid <CoordinateType, PriorityType>;
+using TTPathfinding  = nav::TPathfinding <TTSquareGrid, CoordinateType, PriorityType>;
+using TTFlowField    = nav::TFlowField   <TTSquareGrid, CoordinateType, PriorityType>;
+using TTSearchState  = TTPathfinding::TTSearchState;
+using TTQuery        = TTPathfinding::SQuery;
+using TTClock        = std::chrono::steady_clock;
+
+/// \brief  The number of calls to the global heap, see BenchmarkAllocation
+static std::atomic<std::size_t> s_heap_calls { 0 };
+
+// Out of line, the inlined malloc and free would be paired with the
+// library new and deletes
+#if defined(__GNUC__)
+#define BENCHMARK_NOINLINE __attribute__((noinline))
+#else
+#define BENCHMARK_NOINLINE
+#endif
+
+BENCHMARK_NOINLINE void* operator new(std::size_t size)
+{
+    s_heap_calls.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size != 0 ? size : 1))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+BENCHMARK_NOINLINE void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+BENCHMARK_NOINLINE void operator delete(void* pointer, std::size_t /* size */) noexcept
+{
+    std::free(pointer);
+}
+
+/// \brief  Fills a grid with randomly blocked nodes
+/// \param  grid The grid to initialize
+/// \param  width The width of the grid
+/// \param  height The height of the grid
+/// \param  density The ratio of blocked nodes
+/// \param  seed The random seed
+template <typename Grid>
+static void BuildRandomGrid(Grid& grid, CoordinateType width, CoordinateType height, double density, unsigned seed)
+{
+    std::mt19937 random(seed);
+    std::bernoulli_distribution blocked(density);
+
+    grid.Initialize(width, height);
+    for (CoordinateType y = 0; y < height; ++y)
+    {
+        for (CoordinateType x = 0; x < width; ++x)
+        {
+            grid.SetNodeNeighbors(x, y, blocked(random) ? TTNode::EFlag::NONE : TTNode::EFlag::ALL);
+        }
+    }
+}
+
+/// \brief  Generates random queries between open nodes
+/// \param  grid The grid
+/// \param  count The number of queries
+/// \param  seed The random seed
+/// \return The queries
+static std::vector<TTQuery> BuildQueries(const TTSquareGrid& grid, std::size_t count, unsigned seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<std::size_t> node(0, grid.GetNodeCount() - 1);
+
+    auto open_node = [&]() -> const TTNode&
+    {
+        while (true)
+        {
+            const TTNode& candidate = grid.GetNodeAt(node(random));
+            if (candidate.GetNeighborFlags() != TTNode::EFlag::NONE)
+                return candidate;
+        }
+    };
+
+    std::vector<TTQuery> queries;
+    queries.reserve(count);
+    for (std::size_t n = 0; n < count; ++n)
+    {
+        const TTNode& start = open_node();
+        const TTNode& end   = open_node();
+        queries.push_back(TTQuery { start, end });
+    }
+
+    return queries;
+}
+
+/// \brief  Returns the elapsed seconds since start
+static double Elapsed(TTClock::time_point start)
+{
+    return std::chrono::duration<double>(TTClock::now() - start).count();
+}
+
+/// \brief  Serial queries throughput of one frontier policy
+/// \tparam Pathfinding The pathfinding class to measure
+template <typename Pathfinding>
+static double MeasureFrontier(const TTSquareGrid& grid, const std::vector<TTQuery>& queries, std::size_t& total_length)
+{
+    typename Pathfinding::TTSearchState state;
+    std::vector<TTNode> path;
+
+    // Warm up, sizes the scratch buffers
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        Pathfinding::GetPath(grid, state, path, query.start, query.end);
+    }
+
+    total_length = 0;
+    const TTClock::time_point start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        Pathfinding::GetPath(grid, state, path, query.start, query.end);
+        total_length += path.size();
+    }
+
+    return queries.size() / Elapsed(start);
+}
+
+/// \brief  Binary heap against bucket queue on the same queries
+static void BenchmarkFrontier()
+{
+    using TTHeuristic         = nav::TManhattanHeuristic<CoordinateType, PriorityType>;
+    using TTHeapPathfinding   = nav::TPathfinding<TTSquareGrid, CoordinateType, PriorityType, TTHeuristic,
+                                                  nav::TBinaryHeapFrontier<CoordinateType, PriorityType>>;
+    using TTBucketPathfinding = nav::TPathfinding<TTSquareGrid, CoordinateType, PriorityType, TTHeuristic,
+                                                  nav::TBucketFrontier<CoordinateType, PriorityType>>;
+
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 512, 512, 0.2, 42);
+
+    const std::vector<TTQuery> queries = BuildQueries(grid, 1024, 7);
+
+    std::size_t heap_length   = 0;
+    std::size_t bucket_length = 0;
+    const double heap   = MeasureFrontier<TTHeapPathfinding>  (grid, queries, heap_length);
+    const double bucket = MeasureFrontier<TTBucketPathfinding>(grid, queries, bucket_length);
+
+    // Both are optimal, only ties may differ
+    std::cout << "frontier=heap"   << " queries/s=" << static_cast<std::size_t>(heap)   << " length=" << heap_length   << std::endl;
+    std::cout << "frontier=bucket" << " queries/s=" << static_cast<std::size_t>(bucket) << " length=" << bucket_length
+              << " speedup=" << bucket / heap << std::endl;
+}
+
+/// \brief  Text import against mapping the binary file of the same map
+static void BenchmarkLoad()
+{
+    const char* text_path   = "benchmark_load.map";
+    const char* binary_path = "benchmark_load.navg";
+    const int   size        = 2048;
+
+    {
+        std::mt19937 random(42);
+        std::bernoulli_distribution blocked(0.2);
+        std::ofstream file(text_path);
+
+        file << "type octile\nheight " << size << "\nwidth " << size << "\nmap\n";
+        for (int y = 0; y < size; ++y)
+        {
+            std::string row(size, '.');
+            for (char& cell : row)
+                cell = blocked(random) ? '@' : '.';
+            file << row << '\n';
+        }
+    }
+
+    TTSquareGrid grid;
+    TTClock::time_point start = TTClock::now();
+    nav::ImportTextMap(text_path, grid);
+    const double text = Elapsed(start);
+
+    nav::SaveMapFile(binary_path, grid);
+
+    TTMappedGrid mapped;
+    start = TTClock::now();
+    mapped.Open(binary_path);
+    const double binary = Elapsed(start);
+
+    // First query, pages are faulted in on demand
+    std::vector<TTNode> path;
+    const std::vector<TTQuery> queries = BuildQueries(grid, 1, 7);
+    start = TTClock::now();
+    nav::TPathfinding<TTMappedGrid, CoordinateType, PriorityType>::GetPath(mapped, path, mapped.GetNodeAt(grid.GetNodeIndex(queries[0].start)), mapped.GetNodeAt(grid.GetNodeIndex(queries[0].end)));
+    const double query = Elapsed(start);
+
+    std::cout << "load=text"   << " ms=" << text   * 1000.0 << std::endl;
+    std::cout << "load=mapped" << " ms=" << binary * 1000.0 << " first_query_ms=" << query * 1000.0
+              << " speedup=" << text / binary << std::endl;
+
+    std::remove(text_path);
+    std::remove(binary_path);
+}
+
+/// \class  CPillarGrid
+/// \brief  Open 4 way grid with scattered one node pillars, computed on the
+///         fly so that a grid larger than the memory can be saved chunk by
+///         chunk. Pillars stand on odd rows and columns, they never touch
+///         each other and the open nodes stay in a single component
+class CPillarGrid
+{
+public:
+
+    explicit CPillarGrid(CoordinateType size) : m_size(size)
+    { /* None */ }
+
+    CoordinateType GetWidth()  const { return m_size; }
+    CoordinateType GetHeight() const { return m_size; }
+
+    TTNode GetNode(CoordinateType x, CoordinateType y) const
+    {
+        TTNode node(x, y);
+        node.SetNeighborFlag(IsPillar(x, y) ? TTNode::EFlag::NONE : TTNode::EFlag::ALL);
+        return node;
+    }
+
+    unsigned char GetNodeCost(CoordinateType /* x */, CoordinateType /* y */) const
+    { return 1; }
+
+    /// \brief  0 for the open nodes, its own label for each pillar
+    std::uint32_t GetComponent(CoordinateType x, CoordinateType y) const
+    { return IsPillar(x, y) ? 1 + static_cast<std::uint32_t>(y) * m_size + x : 0; }
+
+    static bool IsPillar(int x, int y)
+    { return x % 2 == 1 && y % 2 == 1 && (static_cast<unsigned>(x) * 73856093u ^ static_cast<unsigned>(y) * 19349663u) % 3u == 0; }
+
+private:
+
+    CoordinateType m_size; ///< The width and height of the grid
+};
+
+/// \brief  Searches on a chunked grid far larger than its resident chunks
+static void BenchmarkChunked()
+{
+    using TTChunkedGrid   = nav::TChunkedGrid<CoordinateType, PriorityType>;
+    using TTChunkedSearch = nav::TPathfinding<TTChunkedGrid, CoordinateType, PriorityType>;
+
+    const char*          path   = "benchmark_chunked.navc";
+    const CoordinateType size   = 8192;
+    const std::uint32_t  chunk  = 64;
+    const std::size_t    budget = 256;
+
+    TTClock::time_point start = TTClock::now();
+    nav::SaveChunkedMapFile(path, CPillarGrid(size), chunk);
+    const double save = Elapsed(start);
+
+    TTChunkedGrid grid;
+    grid.Open(path, budget);
+
+    // Open nodes a few chunks apart, the paths cross many unloaded chunks
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> coordinate(0, size - 1);
+    std::uniform_int_distribution<int> offset(-1024, 1024);
+
+    TTChunkedSearch::TTSearchState state;
+    std::vector<TTNode> result;
+    std::size_t         found  = 0;
+    std::size_t         length = 0;
+    std::size_t         peak   = 0;
+
+    start = TTClock::now();
+    for (std::size_t n = 0; n < 32; ++n)
+    {
+        // Even coordinates are never pillars
+        const int x  = coordinate(random) & ~1;
+        const int y  = coordinate(random) & ~1;
+        const int ex = std::min<int>(size - 1, std::max(0, x + offset(random))) & ~1;
+        const int ey = std::min<int>(size - 1, std::max(0, y + offset(random))) & ~1;
+
+        const TTNode from = grid.GetNode(static_cast<CoordinateType>(x),  static_cast<CoordinateType>(y));
+        const TTNode to   = grid.GetNode(static_cast<CoordinateType>(ex), static_cast<CoordinateType>(ey));
+
+        result.clear();
+        found  += TTChunkedSearch::GetPath(grid, state, result, from, to);
+        length += result.size();
+        peak    = std::max(peak, state.GetMemoryUsage());
+    }
+    const double search = Elapsed(start);
+
+    // Flags, costs and components of a chunk
+    const std::size_t chunk_bytes = chunk * chunk * (2 + sizeof(std::uint32_t));
+    const std::size_t dense       = grid.GetNodeCount() * TTSearchState::GetEntrySize();
+
+    std::cout << "nodes="        << grid.GetNodeCount()
+              << " save_ms="     << save * 1e3
+              << " grid_kb="     << grid.GetNodeCount() / chunk / chunk * chunk_bytes / 1024
+              << " resident_kb=" << budget * chunk_bytes / 1024 << std::endl;
+    std::cout << "queries=32"    << " found=" << found << " length=" << length
+              << " ms="          << search * 1e3
+              << " loads="       << grid.GetLoadCount()
+              << " stalls="      << grid.GetStallCount() << std::endl;
+    std::cout << "state=paged"   << " peak_kb=" << peak  / 1024 << std::endl;
+    std::cout << "state=dense"   << " kb="      << dense / 1024 << " (not allocated)" << std::endl;
+
+    grid.Close();
+    std::remove(path);
+}
+
+/// \brief  Serial queries throughput on any grid
+/// \tparam Grid The grid class to measure
+template <typename Grid>
+static double MeasureGrid(const Grid& grid, const std::vector<TTQuery>& queries, std::size_t& total_length)
+{
+    using TTGridPathfinding = nav::TPathfinding<Grid, CoordinateType, PriorityType>;
+
+    typename TTGridPathfinding::TTSearchState state;
+    std::vector<TTNode> path;
+
+    total_length = 0;
+    const TTClock::time_point start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        TTGridPathfinding::GetPath(grid, state, path, grid.GetNode(query.start.X(), query.start.Y()), grid.GetNode(query.end.X(), query.end.Y()));
+        total_length += path.size();
+    }
+
+    return queries.size() / Elapsed(start);
+}
+
+/// \brief  Node array grid against the packed flags grid
+static void BenchmarkCompact()
+{
+    TTSquareGrid  square;
+    TTCompactGrid compact;
+    BuildRandomGrid(square,  1024, 1024, 0.2, 42);
+    BuildRandomGrid(compact, 1024, 1024, 0.2, 42);
+    compact.UpdateComponents();
+
+    const std::vector<TTQuery> queries = BuildQueries(square, 256, 7);
+
+    std::size_t square_length  = 0;
+    std::size_t compact_length = 0;
+    const double square_rate  = MeasureGrid(square,  queries, square_length);
+    const double compact_rate = MeasureGrid(compact, queries, compact_length);
+
+    const double count = static_cast<double>(square.GetNodeCount());
+    std::cout << "grid=square"  << " bytes/node=" << square.GetMemoryUsage()  / count
+              << " queries/s="  << static_cast<std::size_t>(square_rate)  << " length=" << square_length  << std::endl;
+    std::cout << "grid=compact" << " bytes/node=" << compact.GetMemoryUsage() / count
+              << " queries/s="  << static_cast<std::size_t>(compact_rate) << " length=" << compact_length << std::endl;
+}
+
+/// \brief  Runtime sized grid against the compile time sized one
+static void BenchmarkStatic()
+{
+    // 2^k - 1 nodes wide, rows are a power of two apart with the shared sentinel
+    using TTStaticGrid = nav::TStaticSquareGrid<511, 511, CoordinateType, PriorityType>;
+
+    TTSquareGrid square;
+    BuildRandomGrid(square, 511, 511, 0.2, 42);
+
+    // Too large for the stack
+    std::unique_ptr<TTStaticGrid> fixed(new TTStaticGrid());
+    for (CoordinateType y = 0; y < 511; ++y)
+    {
+        for (CoordinateType x = 0; x < 511; ++x)
+            fixed->SetNodeNeighbors(x, y, square.GetNode(x, y).GetNeighborFlags());
+    }
+    fixed->UpdateComponents();
+
+    const std::vector<TTQuery> queries = BuildQueries(square, 1024, 7);
+
+    // Warm up, sizes the scratch buffers
+    std::size_t square_length = 0;
+    std::size_t fixed_length  = 0;
+    MeasureGrid(square, queries, square_length);
+    MeasureGrid(*fixed, queries, fixed_length);
+
+    const double square_rate = MeasureGrid(square, queries, square_length);
+    const double fixed_rate  = MeasureGrid(*fixed, queries, fixed_length);
+
+    // Same neighbor order, the paths are the same
+    std::cout << "grid=dynamic" << " stride=" << square.GetWidth()    << " queries/s=" << static_cast<std::size_t>(square_rate)
+              << " length="     << square_length << std::endl;
+    std::cout << "grid=static"  << " stride=" << TTStaticGrid::STRIDE << " queries/s=" << static_cast<std::size_t>(fixed_rate)
+              << " length="     << fixed_length  << " speedup=" << fixed_rate / square_rate << std::endl;
+}
+
+/// \class  CCacheMissCounter
+/// \brief  Counts the last level cache misses of the calling thread
+///         Not available outside Linux or without perf events access
+class CCacheMissCounter
+{
+public:
+
+    CCacheMissCounter()
+    {
+#if defined(__linux__)
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.type           = PERF_TYPE_HARDWARE;
+        attributes.size           = sizeof(attributes);
+        attributes.config         = PERF_COUNT_HW_CACHE_MISSES;
+        attributes.disabled       = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv     = 1;
+
+        m_descriptor = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CCacheMissCounter()
+    {
+#if defined(__linux__)
+        if (m_descriptor >= 0)
+            close(m_descriptor);
+#endif
+    }
+
+    CCacheMissCounter(const CCacheMissCounter&)            = delete;
+    CCacheMissCounter& operator=(const CCacheMissCounter&) = delete;
+
+    /// \brief  Resets and starts the counter
+    void Start()
+    {
+#if defined(__linux__)
+        if (m_descriptor >= 0)
+        {
+            ioctl(m_descriptor, PERF_EVENT_IOC_RESET,  0);
+            ioctl(m_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    /// \brief  Stops the counter
+    /// \return The number of misses since Start, -1 if not available
+    long long Stop()
+    {
+        long long misses = -1;
+#if defined(__linux__)
+        if (m_descriptor >= 0)
+        {
+            ioctl(m_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(m_descriptor, &misses, sizeof(misses)) != sizeof(misses))
+                misses = -1;
+        }
+#endif
+        return misses;
+    }
+
+private:
+
+    int m_descriptor = -1; ///< The perf event, -1 if not available
+};
+
+/// \brief  Throughput, expansion rate and cache misses of one layout
+/// \tparam Layout The layout policy to measure
+template <typename Layout>
+static void MeasureLayout(const char* name, const std::vector<TTQuery>& queries)
+{
+    using TTLayoutGrid        = nav::TSquareGrid<CoordinateType, PriorityType, nav::TFourWayMoves<PriorityType>, Layout>;
+    using TTLayoutPathfinding = nav::TPathfinding<TTLayoutGrid, CoordinateType, PriorityType>;
+    using TTCountingSearch    = nav::TPathfinding<TTLayoutGrid, CoordinateType, PriorityType,
+                                                  nav::TManhattanHeuristic<CoordinateType, PriorityType>,
+                                                  nav::TDefaultFrontier   <CoordinateType, PriorityType>,
+                                                  nav::TSearchStats       <CoordinateType, PriorityType>>;
+
+    TTLayoutGrid grid;
+    BuildRandomGrid(grid, 4096, 4096, 0.2, 42);
+
+    // Expansions are counted aside, the timed run is not instrumented
+    std::size_t expanded = 0;
+    {
+        typename TTCountingSearch::TTSearchState state;
+        std::vector<TTNode> path;
+        for (const TTQuery& query : queries)
+        {
+            path.clear();
+            TTCountingSearch::GetPath(grid, state, path, grid.GetNode(query.start.X(), query.start.Y()), grid.GetNode(query.end.X(), query.end.Y()));
+            expanded += state.GetStats().GetExpandedCount();
+        }
+    }
+
+    typename TTLayoutPathfinding::TTSearchState state;
+    std::vector<TTNode> path;
+    CCacheMissCounter   counter;
+    std::size_t         length = 0;
+
+    // Warm up, sizes the search state
+    TTLayoutPathfinding::GetPath(grid, state, path, grid.GetNode(queries[0].start.X(), queries[0].start.Y()), grid.GetNode(queries[0].end.X(), queries[0].end.Y()));
+
+    counter.Start();
+    const TTClock::time_point start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        TTLayoutPathfinding::GetPath(grid, state, path, grid.GetNode(query.start.X(), query.start.Y()), grid.GetNode(query.end.X(), query.end.Y()));
+        length += path.size();
+    }
+    const double    elapsed = Elapsed(start);
+    const long long misses  = counter.Stop();
+
+    std::cout << "layout="        << name
+              << " queries/s="    << static_cast<std::size_t>(queries.size() / elapsed)
+              << " expansions/s=" << static_cast<std::size_t>(expanded / elapsed)
+              << " cache_misses=";
+
+    if (misses < 0) std::cout << "n/a";
+    else            std::cout << misses;
+
+    std::cout << " length=" << length << std::endl;
+}
+
+/// \brief  Row major, tiled and Morton layouts on a large grid
+static void BenchmarkLayout()
+{
+    TTSquareGrid reference;
+    BuildRandomGrid(reference, 4096, 4096, 0.2, 42);
+
+    const std::vector<TTQuery> queries = BuildQueries(reference, 64, 7);
+
+    MeasureLayout<nav::TRowMajorLayout>("row_major", queries);
+    MeasureLayout<nav::TTiledLayout<>> ("tiled",     queries);
+    MeasureLayout<nav::TMortonLayout<>>("morton",    queries);
+}
+
+/// \brief  One search per agent against one flow field shared by all agents
+static void BenchmarkFlow()
+{
+    const std::size_t agent_count = 512;
+
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 512, 512, 0.2, 42);
+
+    // All agents head to the goal of the first query
+    std::vector<TTQuery> queries = BuildQueries(grid, agent_count, 7);
+    for (TTQuery& query : queries)
+        query.end = queries.front().end;
+
+    TTSearchState       state;
+    std::vector<TTNode> path;
+    std::size_t         search_length = 0;
+    std::size_t         field_length  = 0;
+
+    TTClock::time_point start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        TTPathfinding::GetPath(grid, state, path, query.start, query.end);
+        search_length += path.size();
+    }
+    const double search = Elapsed(start);
+
+    nav::CWorkStealingPool pool;
+    TTFlowField            field;
+
+    start = TTClock::now();
+    field.Build(grid, queries.front().end, pool);
+    const double build = Elapsed(start);
+
+    start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        field.GetPath(grid, path, query.start);
+        field_length += path.size();
+    }
+    const double follow = Elapsed(start);
+
+    std::cout << "agents="     << agent_count
+              << " search_ms=" << search * 1e3
+              << " build_ms="  << build  * 1e3
+              << " follow_ms=" << follow * 1e3
+              << " speedup="   << search / (build + follow)
+              << " length="    << search_length << "/" << field_length << std::endl;
+}
+
+/// \brief  Queries throughput and expansions of a heuristic instance
+/// \tparam Heuristic The heuristic policy to measure
+template <typename Heuristic>
+static void MeasureHeuristic(const char* name, const Heuristic& heuristic, const TTSquareGrid& grid, const std::vector<TTQuery>& queries)
+{
+    using TTStats                = nav::TSearchStats<CoordinateType, PriorityType>;
+    using TTHeuristicPathfinding = nav::TPathfinding<TTSquareGrid, CoordinateType, PriorityType, Heuristic,
+                                                     nav::TDefaultFrontier<CoordinateType, PriorityType>, TTStats>;
+
+    typename TTHeuristicPathfinding::TTSearchState state;
+    std::vector<TTNode> path;
+    std::size_t         expanded = 0;
+    std::size_t         length   = 0;
+
+    const TTClock::time_point start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        TTHeuristicPathfinding::GetPath(grid, heuristic, state, path, query.start, query.end);
+        expanded += state.GetStats().GetExpandedCount();
+        length   += path.size();
+    }
+    const double elapsed = Elapsed(start);
+
+    std::cout << "heuristic="       << name
+              << " queries/s="      << static_cast<std::size_t>(queries.size() / elapsed)
+              << " expanded/query=" << expanded / queries.size()
+              << " length="         << length << std::endl;
+}
+
+/// \brief  Manhattan distance against landmarks on a grid of long walls
+static void BenchmarkLandmark()
+{
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 512, 512, 0.1, 42);
+
+    // Walls every 32 columns with a single gap, alternately at the top and bottom
+    for (CoordinateType x = 16; x < 512; x += 32)
+    {
+        const CoordinateType gap = (x / 32) % 2 == 0 ? 1 : 510;
+        for (CoordinateType y = 0; y < 512; ++y)
+        {
+            if (y != gap)
+                grid.SetNodeNeighbors(x, y, TTNode::EFlag::NONE);
+        }
+    }
+
+    const std::vector<TTQuery> queries = BuildQueries(grid, 64, 7);
+
+    nav::CWorkStealingPool                            pool;
+    nav::TLandmarkTable<CoordinateType, PriorityType> table;
+
+    TTClock::time_point start = TTClock::now();
+    table.Build(grid, 16, pool);
+    const double build = Elapsed(start);
+
+    start = TTClock::now();
+    table.Save("landmarks.navl");
+    table.Load("landmarks.navl", grid);
+    const double reload = Elapsed(start);
+    std::remove("landmarks.navl");
+
+    std::cout << "landmarks="  << table.GetLandmarkCount()
+              << " build_ms="  << build  * 1e3
+              << " reload_ms=" << reload * 1e3 << std::endl;
+
+    MeasureHeuristic("manhattan", nav::TManhattanHeuristic<CoordinateType, PriorityType>(), grid, queries);
+    MeasureHeuristic("landmark",  nav::TLandmarkHeuristic <CoordinateType, PriorityType>(table, grid), grid, queries);
+}
+
+/// \brief  Worst tick duration when searches are spread over ticks
+static void BenchmarkSliced()
+{
+    using TTSearch    = nav::TResumableSearch<TTSquareGrid, CoordinateType, PriorityType>;
+    using TTScheduler = nav::TSearchScheduler<TTSearch>;
+
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 512, 512, 0.2, 42);
+
+    const std::vector<TTQuery> queries = BuildQueries(grid, 64, 7);
+
+    // Whole searches, one per tick
+    std::vector<TTNode> path;
+    double              worst_search = 0.0;
+    for (const TTQuery& query : queries)
+    {
+        const TTClock::time_point start = TTClock::now();
+        path.clear();
+        TTPathfinding::GetPath(grid, path, query.start, query.end);
+        worst_search = std::max(worst_search, Elapsed(start));
+    }
+
+    // All searches submitted at once, a fixed budget per tick, with one
+    // search state per query then with the default pool of states
+    for (std::size_t budget : { 2000, 20000 })
+    {
+        for (std::size_t active : { queries.size(), std::size_t(16) })
+        {
+            TTScheduler scheduler(64, TTSearch::TTHeuristic(), active);
+            for (const TTQuery& query : queries)
+                scheduler.Submit(grid, query.start, query.end);
+
+            std::size_t ticks      = 0;
+            std::size_t peak       = scheduler.GetMemoryUsage();
+            double      worst_tick = 0.0;
+            while (scheduler.GetPendingCount() > 0)
+            {
+                const TTClock::time_point start = TTClock::now();
+                scheduler.Tick(budget);
+                worst_tick = std::max(worst_tick, Elapsed(start));
+                peak       = std::max(peak, scheduler.GetMemoryUsage());
+                ++ticks;
+            }
+
+            std::cout << "budget="          << budget
+                      << " active="         << active
+                      << " ticks="          << ticks
+                      << " worst_tick_us="  << worst_tick   * 1e6
+                      << " worst_query_us=" << worst_search * 1e6
+                      << " peak_kb="        << peak / 1024 << std::endl;
+        }
+    }
+}
+
+/// \brief  One long query spread over an increasing number of threads
+static void BenchmarkDistributed()
+{
+    using TTDistributedSearch = nav::THashDistributedSearch<TTSquareGrid, CoordinateType, PriorityType>;
+
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 2048, 2048, 0.3, 42);
+
+    // Corner to corner, the open nodes of the diagonal closest to the corners
+    TTNode start = grid.GetNode(0, 0);
+    TTNode end   = grid.GetNode(2047, 2047);
+    for (CoordinateType d = 0; d < 2048; ++d)
+    {
+        if (grid.GetNode(d, d).GetNeighborFlags() != TTNode::EFlag::NONE)
+        {
+            start = grid.GetNode(d, d);
+            break;
+        }
+    }
+    for (CoordinateType d = 2047; d >= 0; --d)
+    {
+        if (grid.GetNode(d, d).GetNeighborFlags() != TTNode::EFlag::NONE)
+        {
+            end = grid.GetNode(d, d);
+            break;
+        }
+    }
+
+    std::vector<TTNode> path;
+    TTClock::time_point begin = TTClock::now();
+    TTPathfinding::GetPath(grid, path, start, end);
+    const double reference = Elapsed(begin);
+
+    std::cout << "search=astar ms=" << reference * 1e3 << " length=" << path.size() << std::endl;
+
+    // Powers of two, then all the hardware threads
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> thread_counts;
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2)
+        thread_counts.push_back(threads);
+    thread_counts.push_back(max_threads);
+
+    for (std::size_t threads : thread_counts)
+    {
+        TTDistributedSearch search(threads);
+
+        path.clear();
+        begin = TTClock::now();
+        search.GetPath(grid, path, start, end);
+        const double elapsed = Elapsed(begin);
+
+        std::cout << "threads="   << threads
+                  << " ms="       << elapsed * 1e3
+                  << " expanded=" << search.GetExpandedCount()
+                  << " messages=" << search.GetMessageCount()
+                  << " speedup="  << reference / elapsed
+                  << " length="   << path.size() << std::endl;
+    }
+}
+
+/// \brief  Range checks and floods on bit planes against A* queries
+static void BenchmarkBitGrid()
+{
+    using TTBitGrid = nav::TBitGrid<CoordinateType, PriorityType>;
+
+    const std::size_t steps = 32;
+
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 512, 512, 0.2, 42);
+
+    TTBitGrid bits;
+    bits.Build(grid);
+
+    // Targets around the start, as for range checks
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> offset(-static_cast<int>(steps), static_cast<int>(steps));
+    std::vector<TTQuery> queries = BuildQueries(grid, 4096, 7);
+    for (TTQuery& query : queries)
+    {
+        const int x = std::min(std::max(query.start.X() + offset(random), 0), 511);
+        const int y = std::min(std::max(query.start.Y() + offset(random), 0), 511);
+        query.end = grid.GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y));
+    }
+
+    // The grid has unit costs, the length of a path is its number of moves
+    std::vector<TTNode> path;
+    std::size_t         astar_hits = 0;
+    TTClock::time_point start      = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        if (TTPathfinding::GetPath(grid, path, query.start, query.end) && path.size() <= steps + 1)
+            ++astar_hits;
+    }
+    const double astar = queries.size() / Elapsed(start);
+
+    std::size_t bit_hits = 0;
+    start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        if (bits.IsReachableWithin(query.start, query.end, steps))
+            ++bit_hits;
+    }
+    const double bit = queries.size() / Elapsed(start);
+
+    std::cout << "check=astar" << " queries/s=" << static_cast<std::size_t>(astar) << " hits=" << astar_hits << std::endl;
+    std::cout << "check=bits"  << " queries/s=" << static_cast<std::size_t>(bit)   << " hits=" << bit_hits
+              << " speedup=" << bit / astar << std::endl;
+
+    // One bounded fill answers the checks of all the targets of an agent
+    const std::size_t targets = 16;
+    std::size_t       marked  = 0;
+    std::size_t       fill_hits = 0;
+    start = TTClock::now();
+    for (std::size_t n = 0; n + targets <= queries.size(); n += targets)
+    {
+        marked += bits.FloodFill(queries[n].start, steps);
+        for (std::size_t target = 0; target < targets; ++target)
+        {
+            const TTNode& end = queries[n + target].end;
+            fill_hits += bits.IsFilled(end.X(), end.Y());
+        }
+    }
+    const double fill = queries.size() / Elapsed(start);
+
+    std::cout << "check=fill"  << " queries/s=" << static_cast<std::size_t>(fill)  << " targets=" << targets
+              << " marked="    << marked << " speedup=" << fill / astar << std::endl;
+
+    // Distances in range and whole regions
+    std::vector<std::uint32_t> distances;
+    std::size_t                reached = 0;
+    start = TTClock::now();
+    for (std::size_t n = 0; n < 256; ++n)
+        reached += bits.GetLayers(queries[n].start, steps, distances);
+    const double layers = Elapsed(start) / 256;
+
+    std::size_t filled = 0;
+    start = TTClock::now();
+    for (std::size_t n = 0; n < 256; ++n)
+        filled += bits.FloodFill(queries[n].start);
+    const double flood = Elapsed(start) / 256;
+
+    std::cout << "layers_us="  << layers * 1e6
+              << " reached="   << reached
+              << " flood_us="  << flood  * 1e6
+              << " filled="    << filled
+              << " memory_kb=" << bits.GetMemoryUsage() / 1024 << std::endl;
+}
+
+/// \brief  Size and lookup speed of the first move table against A* queries
+static void BenchmarkFirstMove()
+{
+    using TTFirstMoveTable = nav::TFirstMoveTable<CoordinateType, PriorityType>;
+
+    const char* table_path = "benchmark_first_move.navm";
+
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 128, 128, 0.2, 42);
+
+    const std::vector<TTQuery> queries = BuildQueries(grid, 4096, 7);
+
+    nav::CWorkStealingPool pool(std::max(1u, std::thread::hardware_concurrency()));
+    TTFirstMoveTable       table;
+
+    TTClock::time_point start = TTClock::now();
+    table.Build(grid, pool);
+    const double build = Elapsed(start);
+
+    // Reloaded from the disk, as served
+    table.Save(table_path);
+    TTFirstMoveTable loaded;
+    start = TTClock::now();
+    loaded.Load(table_path);
+    const double load = Elapsed(start);
+    std::remove(table_path);
+
+    // Uncompressed, 4 bits per source and target
+    const std::size_t raw = grid.GetNodeCount() * grid.GetNodeCount() / 2;
+
+    std::cout << "build_s="     << build
+              << " load_ms="    << load * 1e3
+              << " runs="       << loaded.GetRunCount()
+              << " table_kb="   << loaded.GetMemoryUsage() / 1024
+              << " raw_kb="     << raw / 1024
+              << " ratio="      << static_cast<double>(raw) / loaded.GetMemoryUsage() << std::endl;
+
+    std::vector<TTNode> path;
+    std::size_t         astar_length = 0;
+    start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        TTPathfinding::GetPath(grid, path, query.start, query.end);
+        astar_length += path.size();
+    }
+    const double astar = queries.size() / Elapsed(start);
+
+    std::size_t table_length = 0;
+    start = TTClock::now();
+    for (const TTQuery& query : queries)
+    {
+        path.clear();
+        loaded.GetPath(grid, path, query.start, query.end);
+        table_length += path.size();
+    }
+    const double lookup = queries.size() / Elapsed(start);
+
+    // Unit costs, both paths are optimal and have the same length
+    std::cout << "search=astar" << " queries/s=" << static_cast<std::size_t>(astar)  << " length=" << astar_length << std::endl;
+    std::cout << "search=table" << " queries/s=" << static_cast<std::size_t>(lookup) << " length=" << table_length
+              << " speedup=" << lookup / astar << std::endl;
+}
+
+/// \brief  Batch queries throughput for an increasing number of threads
+static void BenchmarkBatch()
+{
+    const std::size_t query_count = 4096;
+
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 512, 512, 0.2, 42);
+
+    const std::vector<TTQuery> queries = BuildQueries(grid, query_count, 7);
+    std::vector<std::vector<TTNode>> paths(query_count);
+    std::unique_ptr<bool[]> found(new bool[query_count]);
+
+    // Powers of two, then all the hardware threads
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> thread_counts;
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2)
+        thread_counts.push_back(threads);
+    thread_counts.push_back(max_threads);
+
+    double reference = 0.0;
+    for (std::size_t threads : thread_counts)
+    {
+        nav::CWorkStealingPool     pool(threads);
+        std::vector<TTSearchState> states;
+
+        // Warm up, sizes the scratch buffers and the result slots
+        TTPathfinding::GetPaths(grid, pool, states, queries.data(), query_count, paths.data(), found.get());
+
+        const TTClock::time_point start = TTClock::now();
+        TTPathfinding::GetPaths(grid, pool, states, queries.data(), query_count, paths.data(), found.get());
+        const double rate = query_count / Elapsed(start);
+
+        if (threads == 1)
+            reference = rate;
+
+        std::cout << "threads="    << threads
+                  << " queries/s=" << static_cast<std::size_t>(rate)
+                  << " speedup="   << rate / reference << std::endl;
+    }
+}
+
+/// \brief  Calls to the global heap per query, heap states against an arena state
+static void BenchmarkAllocation()
+{
+    using TTAllocator          = nav::TArenaAllocator<TTNode, CStackAllocator>;
+    using TTHeuristic          = nav::TManhattanHeuristic<CoordinateType, PriorityType>;
+    using TTArenaPathfinding   = nav::TPathfinding<TTSquareGrid, CoordinateType, PriorityType, TTHeuristic,
+                                                   nav::TDefaultFrontier<CoordinateType, PriorityType, TTAllocator>,
+                                                   nav::TNoSearchStats<CoordinateType, PriorityType>, TTAllocator>;
+    using TTArenaSearchState   = TTArenaPathfinding::TTSearchState;
+
+    TTSquareGrid grid;
+    BuildRandomGrid(grid, 512, 512, 0.2, 42);
+
+    const std::vector<TTQuery> queries = BuildQueries(grid, 256, 7);
+
+    // The path is the caller's, reserved once for all the runs
+    std::vector<TTNode> path;
+    path.reserve(grid.GetNodeCount());
+
+    auto run = [&](const char* name, auto search)
+    {
+        const std::size_t         calls  = s_heap_calls.load();
+        const TTClock::time_point start  = TTClock::now();
+        std::size_t               length = 0;
+        for (const TTQuery& query : queries)
+        {
+            path.clear();
+            search(query);
+            length += path.size();
+        }
+
+        const double elapsed = Elapsed(start);
+        std::cout << "state="       << name
+                  << " heap_calls=" << s_heap_calls.load() - calls
+                  << " queries/s="  << static_cast<std::size_t>(queries.size() / elapsed)
+                  << " length="     << length << std::endl;
+    };
+
+    // New state, the buffers grow during the first queries
+    TTSearchState heap_state;
+    run("heap_cold", [&](const TTQuery& query) { TTPathfinding::GetPath(grid, heap_state, path, query.start, query.end); });
+    run("heap_warm", [&](const TTQuery& query) { TTPathfinding::GetPath(grid, heap_state, path, query.start, query.end); });
+
+    // Arena state, the buffers grow in the arena from the first query
+    CStackAllocator arena;
+    arena.Initialize(32 * 1024 * 1024);
+    {
+        TTArenaSearchState arena_state { TTAllocator(arena) };
+        run("arena_cold", [&](const TTQuery& query) { TTArenaPathfinding::GetPath(grid, arena_state, path, query.start, query.end); });
+        run("arena_warm", [&](const TTQuery& query) { TTArenaPathfinding::GetPath(grid, arena_state, path, query.start, query.end); });
+    }
+
+    std::cout << "arena_kb=" << arena.GetHead() / 1024 << std::endl;
+    arena.Clear();
+}
+
+int main(int argc, char ** argv)
+{
+    struct SBenchmark
+    {
+        const char * name;
+        void (*run)();
+    };
+
+    const SBenchmark benchmarks[] =
+    {
+        { "allocation",  BenchmarkAllocation  },
+        { "batch",       BenchmarkBatch       },
+        { "bitgrid",     BenchmarkBitGrid     },
+        { "chunked",     BenchmarkChunked     },
+        { "compact",     BenchmarkCompact     },
+        { "distributed", BenchmarkDistributed },
+        { "firstmove",   BenchmarkFirstMove   },
+        { "flow",        BenchmarkFlow        },
+        { "frontier",    BenchmarkFrontier    },
+        { "landmark",    BenchmarkLandmark    },
+        { "layout",      BenchmarkLayout      },
+        { "load",        BenchmarkLoad        },
+        { "sliced",      BenchmarkSliced      },
+        { "static",      BenchmarkStatic      }
+    };
+
+    for (const SBenchmark& benchmark : benchmarks)
+    {
+        if (argc < 2 || std::strcmp(argv[1], benchmark.name) == 0)
+        {
+            std::cout << "[" << benchmark.name << "]" << std::endl;
+            benchmark.run();
+        }
+    }
+
+    return 0;
+}
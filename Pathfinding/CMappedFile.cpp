@@ -0,0 +1,144 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       CMappedFile.cpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#if defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#endif
+
+#include "CMappedFile.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  Unmaps the file
+CMappedFile::~CMappedFile()
+{
+    Close();
+}
+
+/// \brief  Maps a file, the previous mapping is closed
+/// \param  path The path of the file
+/// \return true on success
+bool CMappedFile::Open(const char* path)
+{
+    Close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mp_file    = file;
+    mp_mapping = mapping;
+    mp_data    = static_cast<const unsigned char*>(data);
+    m_size     = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int file = open(path, O_RDONLY);
+    if (file < 0)
+        return false;
+
+    struct stat status;
+    if (fstat(file, &status) != 0 || status.st_size == 0)
+    {
+        close(file);
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+
+    // The mapping keeps its own reference on the file
+    close(file);
+
+    if (data == MAP_FAILED)
+        return false;
+
+    mp_data = static_cast<const unsigned char*>(data);
+    m_size  = static_cast<std::size_t>(status.st_size);
+#endif
+
+    return true;
+}
+
+/// \brief  Unmaps the file
+void CMappedFile::Close()
+{
+    if (mp_data == nullptr)
+        return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(mp_data);
+    CloseHandle(static_cast<HANDLE>(mp_mapping));
+    CloseHandle(static_cast<HANDLE>(mp_file));
+    mp_file    = nullptr;
+    mp_mapping = nullptr;
+#else
+    munmap(const_cast<unsigned char*>(mp_data), m_size);
+#endif
+
+    mp_data = nullptr;
+    m_size  = 0;
+}
+
+/// \brief  Returns the first byte of the file
+/// \return The mapped bytes or nullptr if closed
+const unsigned char* CMappedFile::GetData() const
+{
+    return mp_data;
+}
+
+/// \brief  Returns the size of the file
+/// \return The size in bytes
+std::size_t CMappedFile::GetSize() const
+{
+    return m_size;
+}
+
+} // !namespace nav
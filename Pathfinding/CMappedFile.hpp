@@ -0,0 +1,79 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       CMappedFile.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_C_MAPPED_FILE_HPP
+#define PATHFINDING_C_MAPPED_FILE_HPP
+
+#include <cstdlib>
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  CMappedFile
+/// \brief  Read only memory mapping of a whole file
+///
+///         Pages are loaded by the system on first access
+///         and shared between the processes mapping the same file.
+class CMappedFile
+{
+public:
+
+    /// \brief  Creates a closed mapping
+    CMappedFile() = default;
+
+    /// \brief  Unmaps the file
+    ~CMappedFile();
+
+    CMappedFile(const CMappedFile&)            = delete;
+    CMappedFile& operator=(const CMappedFile&) = delete;
+
+    /// \brief  Maps a file, the previous mapping is closed
+    /// \param  path The path of the file
+    /// \return true on success
+    bool Open(const char* path);
+
+    /// \brief  Unmaps the file
+    void Close();
+
+    /// \brief  Returns the first byte of the file
+    /// \return The mapped bytes or nullptr if closed
+    const unsigned char* GetData() const;
+
+    /// \brief  Returns the size of the file
+    /// \return The size in bytes
+    std::size_t GetSize() const;
+
+private:
+
+    const unsigned char* mp_data = nullptr; ///< The mapped bytes
+    std::size_t          m_size  = 0;       ///< The size of the mapping
+
+#if defined(_WIN32)
+    void*                mp_file    = nullptr; ///< The file handle
+    void*                mp_mapping = nullptr; ///< The mapping handle
+#endif
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_C_MAPPED_FILE_HPP
@@ -0,0 +1,181 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       CWorkStealingPool.cpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <algorithm>
+
+#include "CWorkStealingPool.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  Starts the workers
+/// \param  threadCount The number of threads, calling thread included
+CWorkStealingPool::CWorkStealingPool(std::size_t threadCount)
+{
+    threadCount = std::max<std::size_t>(threadCount, 1);
+
+    for (std::size_t worker = 0; worker < threadCount; ++worker)
+    {
+        m_queues.emplace_back(new SQueue());
+    }
+
+    for (std::size_t worker = 1; worker < threadCount; ++worker)
+    {
+        m_threads.emplace_back(&CWorkStealingPool::WorkerLoop, this, worker);
+    }
+}
+
+/// \brief  Stops and joins the workers
+CWorkStealingPool::~CWorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_start.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+/// \brief  Runs task over [0, count) and returns once all chunks are done
+/// \param  count The number of items
+/// \param  grain The number of items per chunk
+/// \param  task The task to run on each chunk
+void CWorkStealingPool::ParallelFor(std::size_t count, std::size_t grain, const Task& task)
+{
+    grain = std::max<std::size_t>(grain, 1);
+
+    // Deals the chunks round robin, workers start with balanced queues
+    std::size_t worker = 0;
+    for (std::size_t begin = 0; begin < count; begin += grain)
+    {
+        SQueue& queue = *m_queues[worker];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ranges.emplace_back(begin, std::min(begin + grain, count));
+
+        worker = (worker + 1) % m_queues.size();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        mp_task    = &task;
+        m_finished = 0;
+        ++m_generation;
+    }
+
+    m_start.notify_all();
+
+    RunChunks(0);
+
+    // Every pool thread must leave the loop before the task goes out of scope
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_finished == m_threads.size(); });
+    mp_task = nullptr;
+}
+
+/// \brief  Returns the number of threads, calling thread included
+/// \return The number of workers
+std::size_t CWorkStealingPool::GetThreadCount() const
+{
+    return m_queues.size();
+}
+
+/// \brief  Loop of the pool threads
+/// \param  worker The index of the worker
+void CWorkStealingPool::WorkerLoop(std::size_t worker)
+{
+    std::size_t generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [this, generation] { return m_stop || m_generation != generation; });
+
+            if (m_stop)
+                return;
+
+            generation = m_generation;
+        }
+
+        RunChunks(worker);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_finished;
+        }
+
+        m_done.notify_one();
+    }
+}
+
+/// \brief  Runs chunks until no queue has any left
+/// \param  worker The index of the worker
+void CWorkStealingPool::RunChunks(std::size_t worker)
+{
+    std::pair<std::size_t, std::size_t> range;
+    while (PopRange(worker, range))
+    {
+        (*mp_task)(worker, range.first, range.second);
+    }
+}
+
+/// \brief  Pops a chunk from the own queue or steals one
+/// \param  worker The index of the worker
+/// \param  range The popped chunk
+/// \return False if all queues are empty
+bool CWorkStealingPool::PopRange(std::size_t worker, std::pair<std::size_t, std::size_t>& range)
+{
+    {
+        SQueue& own = *m_queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+
+        if (!own.ranges.empty())
+        {
+            range = own.ranges.back();
+            own.ranges.pop_back();
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < m_queues.size(); ++offset)
+    {
+        SQueue& victim = *m_queues[(worker + offset) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (!victim.ranges.empty())
+        {
+            range = victim.ranges.front();
+            victim.ranges.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // !namespace nav
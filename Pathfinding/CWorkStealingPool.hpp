@@ -0,0 +1,106 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       CWorkStealingPool.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_C_WORK_STEALING_POOL_HPP
+#define PATHFINDING_C_WORK_STEALING_POOL_HPP
+
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  CWorkStealingPool
+/// \brief  Fixed pool of worker threads running parallel loops
+///
+///         The range of a loop is cut in chunks dealt to per worker queues.
+///         A worker pops its own chunks from the back and, once empty,
+///         steals from the front of the other queues.
+///         The calling thread takes part in the loop as worker 0.
+class CWorkStealingPool
+{
+public:
+
+    /// \brief  Task run on a chunk : (worker, begin, end)
+    using Task = std::function<void(std::size_t, std::size_t, std::size_t)>;
+
+    /// \brief  Starts the workers
+    /// \param  threadCount The number of threads, calling thread included
+    explicit CWorkStealingPool(std::size_t threadCount = std::thread::hardware_concurrency());
+
+    /// \brief  Stops and joins the workers
+    ~CWorkStealingPool();
+
+    CWorkStealingPool(const CWorkStealingPool&)            = delete;
+    CWorkStealingPool& operator=(const CWorkStealingPool&) = delete;
+
+    /// \brief  Runs task over [0, count) and returns once all chunks are done
+    /// \param  count The number of items
+    /// \param  grain The number of items per chunk
+    /// \param  task The task to run on each chunk
+    void ParallelFor(std::size_t count, std::size_t grain, const Task& task);
+
+    /// \brief  Returns the number of threads, calling thread included
+    /// \return The number of workers
+    std::size_t GetThreadCount() const;
+
+private:
+
+    /// \brief  The chunks owned by a worker
+    struct SQueue
+    {
+        std::mutex                                       mutex;  ///< Protects ranges
+        std::deque<std::pair<std::size_t, std::size_t>>  ranges; ///< [begin, end) chunks
+    };
+
+    /// \brief  Loop of the pool threads
+    void WorkerLoop(std::size_t worker);
+
+    /// \brief  Runs chunks until no queue has any left
+    void RunChunks(std::size_t worker);
+
+    /// \brief  Pops a chunk from the own queue or steals one
+    bool PopRange(std::size_t worker, std::pair<std::size_t, std::size_t>& range);
+
+    std::vector<std::unique_ptr<SQueue>> m_queues;  ///< One queue per worker
+    std::vector<std::thread>             m_threads; ///< Workers 1 to n - 1
+
+    std::mutex              m_mutex;                ///< Protects everything below
+    std::condition_variable m_start;                ///< Signaled on new loop or stop
+    std::condition_variable m_done;                 ///< Signaled when a worker leaves a loop
+    const Task*             mp_task      = nullptr; ///< The task of the current loop
+    std::size_t             m_generation = 0;       ///< Incremented on each loop
+    std::size_t             m_finished   = 0;       ///< Pool threads done with the current loop
+    bool                    m_stop       = false;   ///< Tells the pool threads to exit
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_C_WORK_STEALING_POOL_HPP
@@ -0,0 +1,65 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       SMoveDirection.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_S_MOVE_DIRECTION_HPP
+#define PATHFINDING_S_MOVE_DIRECTION_HPP
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  Direction codes of the moves to the 8 neighbors, shared by
+///         the tables storing one move per node (see TFlowField and
+///         TFirstMoveTable). Codes fit on 3 bits : N, E, S, W, NE, SE, SW, NW
+struct SMoveDirection
+{
+    /// \brief  The code of the null move
+    static constexpr unsigned char NONE = 0xF;
+
+    /// \brief  Returns the move of a direction code
+    /// \param  direction The code (N, E, S, W, NE, SE, SW, NW)
+    /// \param  dx The X offset
+    /// \param  dy The Y offset
+    static inline void GetOffset(unsigned char direction, int& dx, int& dy)
+    {
+        static const int offsets[8][2] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 },
+                                           { 1, -1 }, { 1, 1 }, { -1, 1 }, { -1, -1 } };
+
+        dx = offsets[direction][0];
+        dy = offsets[direction][1];
+    }
+
+    /// \brief  Returns the direction code of a move
+    /// \param  dx The X offset, -1, 0 or 1
+    /// \param  dy The Y offset, -1, 0 or 1
+    /// \return The code, NONE if both offsets are 0
+    static inline unsigned char GetDirection(int dx, int dy)
+    {
+        // Indexed by (dy + 1) * 3 + (dx + 1)
+        static const unsigned char directions[9] = { 7, 0, 4, 3, NONE, 1, 6, 2, 5 };
+        return directions[(dy + 1) * 3 + (dx + 1)];
+    }
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_S_MOVE_DIRECTION_HPP
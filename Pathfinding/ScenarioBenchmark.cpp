@@ -0,0 +1,344 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ScenarioBenchmark.cpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+///
+/// Build  : g++ -std=c++14 -O2 ScenarioBenchmark.cpp
+/// Usage  : ./a.out <map> <scenario> [4|8]
+///          ./a.out --generate <map> <scenario> <width> <height> <density> <count> [4|8]
+///
+/// Runs every query of a MovingAI scenario file on its map and prints
+/// one key=value line, the exit code is 1 if a path length is wrong.
+/// --generate writes a random map and a scenario of reachable queries
+/// whose optimal lengths come from a Dijkstra search on real distances.
+
+#include <cmath>
+#include <chrono>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+
+#include "TMapFile.hpp"
+#include "THeuristic.hpp"
+#include "TSquareGrid.hpp"
+#include "TPathfinding.hpp"
+#include "TSearchStats.hpp"
+
+// Alias to make the code more readable
+using CoordinateType = int;
+using PriorityType   = int;
+using TTClock        = std::chrono::steady_clock;
+
+/// \brief  Returns the real length of a path, sqrt(2) per diagonal step
+template <typename TTNode>
+static double GetLength(const std::vector<TTNode>& path)
+{
+    double length = 0.0;
+    for (std::size_t n = 1; n < path.size(); ++n)
+    {
+        const bool diagonal = path[n].X() != path[n - 1].X() && path[n].Y() != path[n - 1].Y();
+        length += diagonal ? std::sqrt(2.0) : 1.0;
+    }
+
+    return length;
+}
+
+/// \brief  Returns the real length of the shortest path, -1 if there is none
+///         Dijkstra on the moves of the grid with real distances,
+///         independent from the rounded costs of the move policy
+template <typename Grid>
+static double GetOptimalLength(const Grid& grid, const typename Grid::TTNode& start, const typename Grid::TTNode& goal)
+{
+    using TTNode  = typename Grid::TTNode;
+    using TTEntry = std::pair<double, std::size_t>;
+
+    std::vector<double> distances(grid.GetNodeCount(), -1.0);
+    std::priority_queue<TTEntry, std::vector<TTEntry>, std::greater<TTEntry>> open;
+    std::vector<TTNode> neighbors;
+
+    const std::size_t goal_index = grid.GetNodeIndex(goal);
+    distances[grid.GetNodeIndex(start)] = 0.0;
+    open.push(TTEntry(0.0, grid.GetNodeIndex(start)));
+
+    while (!open.empty())
+    {
+        const TTEntry current = open.top();
+        open.pop();
+
+        if (current.second == goal_index)
+            return current.first;
+
+        if (current.first > distances[current.second])
+            continue;
+
+        const TTNode& node = grid.GetNodeAt(current.second);
+        neighbors.clear();
+        grid.GetNeighbors(node, neighbors);
+
+        for (const TTNode& next : neighbors)
+        {
+            const std::size_t index    = grid.GetNodeIndex(next);
+            const bool        diagonal = next.X() != node.X() && next.Y() != node.Y();
+            const double      distance = current.first + (diagonal ? std::sqrt(2.0) : 1.0);
+
+            if (distances[index] < 0.0 || distance < distances[index])
+            {
+                distances[index] = distance;
+                open.push(TTEntry(distance, index));
+            }
+        }
+    }
+
+    return -1.0;
+}
+
+/// \brief  Runs all queries of a scenario and prints the results
+/// \tparam Moves The move policy of the grid
+/// \return 0 if all path lengths are right, 1 otherwise
+template <typename Moves>
+static int Run(const char* map_path, const char* scenario_path)
+{
+    using TTGrid        = nav::TSquareGrid<CoordinateType, PriorityType, Moves>;
+    using TTNode        = typename TTGrid::TTNode;
+    using TTHeuristic   = nav::TOctileHeuristic<CoordinateType, PriorityType, Moves>;
+    using TTFrontier    = nav::TDefaultFrontier<CoordinateType, PriorityType>;
+    using TTStats       = nav::TSearchStats<CoordinateType, PriorityType>;
+    using TTPathfinding = nav::TPathfinding<TTGrid, CoordinateType, PriorityType, TTHeuristic, TTFrontier, TTStats>;
+
+    TTGrid grid;
+    if (!nav::ImportTextMap(map_path, grid))
+    {
+        std::cerr << "error=map path=" << map_path << std::endl;
+        return 1;
+    }
+
+    std::vector<nav::SScenarioQuery> queries;
+    if (!nav::LoadScenarioFile(scenario_path, queries) || queries.empty())
+    {
+        std::cerr << "error=scenario path=" << scenario_path << std::endl;
+        return 1;
+    }
+
+    for (const nav::SScenarioQuery& query : queries)
+    {
+        if (query.width   != static_cast<std::uint32_t>(grid.GetWidth()) || query.height != static_cast<std::uint32_t>(grid.GetHeight()) ||
+            query.start_x >= query.width  || query.goal_x >= query.width ||
+            query.start_y >= query.height || query.goal_y >= query.height)
+        {
+            std::cerr << "error=size map=" << query.map << std::endl;
+            return 1;
+        }
+    }
+
+    // Diagonals cost 14 instead of 10 * sqrt(2) : a path optimal for the
+    // rounded costs may be longer than the optimal one, by this ratio at most
+    const double diagonal  = Moves::DIAGONAL ? Moves::DIAGONAL_COST / std::sqrt(2.0) : Moves::STRAIGHT_COST;
+    const double max_ratio = Moves::STRAIGHT_COST / std::min<double>(Moves::STRAIGHT_COST, diagonal);
+    const double epsilon   = 1e-3;
+
+    typename TTPathfinding::TTSearchState state;
+    std::vector<TTNode>                   path;
+    std::vector<double>                   latencies(queries.size());
+
+    auto run_query = [&](const nav::SScenarioQuery& query)
+    {
+        path.clear();
+        return TTPathfinding::GetPath(grid, state, path,
+                                      grid.GetNode(static_cast<CoordinateType>(query.start_x), static_cast<CoordinateType>(query.start_y)),
+                                      grid.GetNode(static_cast<CoordinateType>(query.goal_x),  static_cast<CoordinateType>(query.goal_y)));
+    };
+
+    // Warm up, sizes the search state
+    for (const nav::SScenarioQuery& query : queries)
+        run_query(query);
+
+    std::size_t found      = 0;
+    std::size_t exact      = 0;
+    std::size_t mismatches = 0;
+    std::size_t expanded   = 0;
+    std::size_t peak       = 0;
+    double      max_excess = 0.0;
+    double      total      = 0.0;
+
+    for (std::size_t n = 0; n < queries.size(); ++n)
+    {
+        const nav::SScenarioQuery& query = queries[n];
+
+        const TTClock::time_point start = TTClock::now();
+        const bool has_path = run_query(query);
+        latencies[n] = std::chrono::duration<double>(TTClock::now() - start).count();
+        total       += latencies[n];
+        expanded    += state.GetStats().GetExpandedCount();
+        peak         = std::max(peak, state.GetStats().GetPeakMemory());
+
+        if (!has_path)
+        {
+            ++mismatches;
+            std::cerr << "mismatch=" << n << " expected=" << query.optimal << " length=none" << std::endl;
+            continue;
+        }
+
+        const double length = GetLength(path);
+
+        ++found;
+        if (std::fabs(length - query.optimal) <= epsilon)
+            ++exact;
+
+        if (query.optimal > 0.0)
+            max_excess = std::max(max_excess, length / query.optimal - 1.0);
+
+        if (length < query.optimal - epsilon || length > query.optimal * max_ratio + epsilon)
+        {
+            ++mismatches;
+            std::cerr << "mismatch=" << n << " expected=" << query.optimal << " length=" << length << std::endl;
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    const double p50 = latencies[latencies.size() / 2];
+    const double p99 = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+
+    std::cout << "map="           << queries.front().map
+              << " moves="        << (Moves::DIAGONAL ? 8 : 4)
+              << " queries="      << queries.size()
+              << " found="        << found
+              << " exact="        << exact
+              << " mismatches="   << mismatches
+              << " max_excess="   << max_excess
+              << " queries/s="    << static_cast<std::size_t>(queries.size() / total)
+              << " expansions/s=" << static_cast<std::size_t>(expanded / total)
+              << " p50_us="       << p50 * 1e6
+              << " p99_us="       << p99 * 1e6
+              << " peak_kb="      << peak / 1024 << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/// \brief  Writes a random map and a scenario of reachable queries
+/// \tparam Moves The move policy the optimal lengths are computed for
+/// \return 0 on success, 1 if a file can't be written
+template <typename Moves>
+static int Generate(const char* map_path, const char* scenario_path, int width, int height, double density, std::size_t count)
+{
+    using TTGrid = nav::TSquareGrid<CoordinateType, PriorityType, Moves>;
+    using TTNode = typename TTGrid::TTNode;
+
+    std::mt19937 random(42);
+    std::bernoulli_distribution blocked(density);
+
+    {
+        std::ofstream file(map_path);
+        if (!file)
+            return 1;
+
+        file << "type octile\nheight " << height << "\nwidth " << width << "\nmap\n";
+        for (int y = 0; y < height; ++y)
+        {
+            std::string row(static_cast<std::size_t>(width), '.');
+            for (char& cell : row)
+                cell = blocked(random) ? '@' : '.';
+
+            file << row << '\n';
+        }
+    }
+
+    TTGrid grid;
+    if (!nav::ImportTextMap(map_path, grid))
+        return 1;
+
+    // The scenario refers to the map by its file name
+    std::string name(map_path);
+    const std::size_t slash = name.find_last_of("/\\");
+    if (slash != std::string::npos)
+        name = name.substr(slash + 1);
+
+    std::uniform_int_distribution<std::size_t> node(0, grid.GetNodeCount() - 1);
+    std::vector<nav::SScenarioQuery> queries;
+
+    // Bounded, a map too blocked may have no pair of reachable nodes
+    for (std::size_t attempt = 0; queries.size() < count && attempt < count * 100; ++attempt)
+    {
+        const TTNode& start = grid.GetNodeAt(node(random));
+        const TTNode& goal  = grid.GetNodeAt(node(random));
+
+        if (start.GetNeighborFlags() == TTNode::NONE || start == goal || !grid.IsReachable(start, goal))
+            continue;
+
+        const double optimal = GetOptimalLength(grid, start, goal);
+        if (optimal < 0.0)
+            continue;
+
+        nav::SScenarioQuery query;
+        query.bucket  = static_cast<std::uint32_t>(optimal / 4.0);
+        query.map     = name;
+        query.width   = static_cast<std::uint32_t>(width);
+        query.height  = static_cast<std::uint32_t>(height);
+        query.start_x = static_cast<std::uint32_t>(start.X());
+        query.start_y = static_cast<std::uint32_t>(start.Y());
+        query.goal_x  = static_cast<std::uint32_t>(goal.X());
+        query.goal_y  = static_cast<std::uint32_t>(goal.Y());
+        query.optimal = optimal;
+        queries.push_back(query);
+    }
+
+    // Grouped by length like the MovingAI scenarios
+    std::stable_sort(queries.begin(), queries.end(), [](const nav::SScenarioQuery& lhs, const nav::SScenarioQuery& rhs)
+    {
+        return lhs.bucket < rhs.bucket;
+    });
+
+    return nav::SaveScenarioFile(scenario_path, queries) ? 0 : 1;
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc >= 8 && std::strcmp(argv[1], "--generate") == 0)
+    {
+        const int         width   = std::atoi(argv[4]);
+        const int         height  = std::atoi(argv[5]);
+        const double      density = std::atof(argv[6]);
+        const std::size_t count   = static_cast<std::size_t>(std::atol(argv[7]));
+        const bool        four    = argc >= 9 && std::strcmp(argv[8], "4") == 0;
+
+        if (width <= 0 || height <= 0)
+            return 1;
+
+        return four ? Generate<nav::TFourWayMoves <PriorityType>>(argv[2], argv[3], width, height, density, count)
+                    : Generate<nav::TEightWayMoves<PriorityType>>(argv[2], argv[3], width, height, density, count);
+    }
+
+    if (argc < 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <map> <scenario> [4|8]" << std::endl;
+        std::cerr << "       " << argv[0] << " --generate <map> <scenario> <width> <height> <density> <count> [4|8]" << std::endl;
+        return 1;
+    }
+
+    // Optimal lengths of MovingAI scenarios are for 8 way moves
+    const bool four = argc >= 4 && std::strcmp(argv[3], "4") == 0;
+    return four ? Run<nav::TFourWayMoves <PriorityType>>(argv[1], argv[2])
+                : Run<nav::TEightWayMoves<PriorityType>>(argv[1], argv[2]);
+}
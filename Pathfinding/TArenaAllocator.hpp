@@ -0,0 +1,101 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TArenaAllocator.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_ARENA_ALLOCATOR_HPP
+#define PATHFINDING_T_ARENA_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <cstdlib>
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TArenaAllocator
+/// \brief  Standard allocator drawing from a bump allocator
+///
+///         Memory is never given back one block at a time, it is freed
+///         all at once when the arena is cleared. The containers using
+///         the allocator must be destroyed before, or not used again.
+///         Growing containers leave their old blocks behind, reserve
+///         what can be reserved.
+///
+/// \tparam T The type of the allocated values
+/// \tparam Arena The bump allocator, needs void* Allocate(std::size_t, std::size_t)
+///               taking the size and the alignment (see StackAllocator/CStackAllocator.hpp)
+template <typename T, typename Arena>
+class TArenaAllocator
+{
+public:
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TArenaAllocator<U, Arena>;
+    };
+
+    /// \brief  Creates an allocator without arena, it can't allocate
+    TArenaAllocator() = default;
+
+    /// \brief  Creates an allocator on an arena, it must outlive the allocations
+    explicit TArenaAllocator(Arena& arena)
+    : mp_arena(&arena)
+    { /* None */ }
+
+    template <typename U>
+    TArenaAllocator(const TArenaAllocator<U, Arena>& other)
+    : mp_arena(other.GetArena())
+    { /* None */ }
+
+    /// \brief  Allocates an array of count values, aligned for T
+    /* inline */ T* allocate(std::size_t count)
+    {
+        // Never empty, the arena refuses empty blocks
+        return static_cast<T*>(mp_arena->Allocate((count > 0 ? count : 1) * sizeof(T), alignof(T)));
+    }
+
+    /// \brief  Does nothing, the memory is freed with the arena
+    /* inline */ void deallocate(T* /* pointer */, std::size_t /* count */)
+    { /* None */ }
+
+    /// \brief  Returns the arena
+    /* inline */ Arena* GetArena() const
+    { return mp_arena; }
+
+private:
+
+    Arena* mp_arena = nullptr; ///< The bump allocator
+};
+
+template <typename T, typename U, typename Arena>
+/* inline */ bool operator==(const TArenaAllocator<T, Arena>& lhs, const TArenaAllocator<U, Arena>& rhs)
+{ return lhs.GetArena() == rhs.GetArena(); }
+
+template <typename T, typename U, typename Arena>
+/* inline */ bool operator!=(const TArenaAllocator<T, Arena>& lhs, const TArenaAllocator<U, Arena>& rhs)
+{ return lhs.GetArena() != rhs.GetArena(); }
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_ARENA_ALLOCATOR_HPP
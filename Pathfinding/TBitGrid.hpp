@@ -0,0 +1,198 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TBitGrid.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_BIT_GRID_HPP
+#define PATHFINDING_T_BIT_GRID_HPP
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <cstddef>
+
+#include "TNode.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TBitGrid
+/// \brief  Bit planes of the moves of a grid for uniform step searches
+///
+///         Each row is a bitmask, one plane per move direction holds the
+///         nodes that can be entered with that move. A breadth first layer
+///         is then computed for a whole row at a time : the previous layer
+///         is shifted by the move and masked by its plane. Only the bounding
+///         box of the previous layer is computed again, the kernels use AVX2
+///         or SSE2 when the compiler targets them, 64 bits words otherwise.
+///
+///         Every move counts as one step, terrain costs are ignored. The
+///         planes are built from the neighbors of the graph, the corner
+///         rules of the move policy are kept.
+///
+///         The searches store their layers and their result in the bit grid
+///         (see IsFilled) and aren't const : share a grid between threads
+///         behind a lock, or give each thread its own copy. A grid edited
+///         after Build must be built again.
+///
+/// \tparam CoordinateType The type of the coordinate system
+/// \tparam PriorityType   The type of the priority
+template <typename CoordinateType, typename PriorityType>
+class TBitGrid
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  The distance of the nodes out of reach (see GetLayers)
+    static constexpr std::uint32_t UNREACHED = std::numeric_limits<std::uint32_t>::max();
+
+    /// \brief  The number of steps of an unbounded search
+    static constexpr std::size_t UNBOUNDED = std::numeric_limits<std::size_t>::max();
+
+    /// \brief  Builds the planes of a graph
+    /// \param  graph The graph, needs GetNode(x, y) and GetNeighbors
+    template <typename Graph>
+    void Build(const Graph& graph);
+
+    /// \brief  Tells if a node can be reached from another one in a number of moves
+    /// \param  from The start node
+    /// \param  to The node to reach
+    /// \param  steps The maximum number of moves
+    /// \return True or false
+    bool IsReachableWithin(const TTNode& from, const TTNode& to, std::size_t steps);
+
+    /// \brief  Computes the number of moves from a node to all nodes in range,
+    ///         the cost grows with the radius times the area, keep it bounded
+    /// \param  from The start node
+    /// \param  maxSteps The maximum number of moves
+    /// \param  distances The moves per node, indexed by y * width + x, UNREACHED out of range
+    /// \return The number of reached nodes, the start node included
+    std::size_t GetLayers(const TTNode& from, std::size_t maxSteps, std::vector<std::uint32_t>& distances);
+
+    /// \brief  Marks all nodes reachable from a node in a number of moves (see IsFilled)
+    ///         Unbounded fills sweep the rows in place until nothing changes
+    /// \param  from The start node
+    /// \param  maxSteps The maximum number of moves
+    /// \return The number of marked nodes, the start node included
+    std::size_t FloodFill(const TTNode& from, std::size_t maxSteps = UNBOUNDED);
+
+    /// \brief  Tells if a node was reached by the last search
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \return True or false
+    inline bool IsFilled(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns the width of the grid
+    inline CoordinateType GetWidth() const;
+
+    /// \brief  Returns the height of the grid
+    inline CoordinateType GetHeight() const;
+
+    /// \brief  Returns the number of bytes used by the planes and the layers
+    inline std::size_t GetMemoryUsage() const;
+
+private:
+
+    /// \brief  A move direction and its plane
+    struct SDirection
+    {
+        int            shift;  ///< The X move, the bit shift of the rows
+        std::ptrdiff_t offset; ///< The offset of the source row of a target word
+        std::size_t    plane;  ///< The offset of the plane in m_planes
+    };
+
+    /// \brief  Rows and words of a row, padding rows included
+    struct SBox
+    {
+        std::size_t first_row  = 0; ///< The first row
+        std::size_t last_row   = 0; ///< One past the last row
+        std::size_t first_word = 0; ///< The first word of the rows
+        std::size_t last_word  = 0; ///< One past the last word
+    };
+
+    /// \brief  Returns the word holding a node
+    inline std::size_t GetWordIndex(int x, int y) const;
+
+    /// \brief  Returns the index of the lowest set bit of a non zero word
+    static inline unsigned GetLowestBit(std::uint64_t word);
+
+    /// \brief  Grows a box to hold words of a row
+    static inline void Extend(SBox& box, std::size_t row, std::size_t firstWord, std::size_t lastWord);
+
+    /// \brief  Zeroes the words of a box
+    void Clear(std::vector<std::uint64_t>& buffer, const SBox& box) const;
+
+    /// \brief  Returns the number of set bits of a box
+    std::size_t Count(const std::vector<std::uint64_t>& buffer, const SBox& box) const;
+
+    /// \brief  Clears the last search and marks the start node
+    /// \param  from The start node
+    /// \return The box of the start node
+    SBox Seed(const TTNode& from);
+
+    /// \brief  Computes the next layer from the current one
+    /// \param  range The words that may change
+    /// \param  box The bounding box of the next layer
+    /// \return true if the layer isn't empty
+    bool Expand(const SBox& range, SBox& box);
+
+    /// \brief  Computes layers until the visitor stops or the layer is empty
+    /// \param  from The start node
+    /// \param  maxSteps The maximum number of layers
+    /// \param  visitor Called with the step and the box of each layer, returns false to stop
+    /// \param  target The only node to reach if not null, the nodes too far from it are skipped
+    template <typename Visitor>
+    void Spread(const TTNode& from, std::size_t maxSteps, Visitor visitor, const TTNode* target = nullptr);
+
+    /// \brief  Adds to a row the nodes entered from the row before it in a sweep
+    /// \param  row The row
+    /// \param  down true for the moves going down, false for the ones going up
+    /// \return true if the row changed
+    bool SweepRow(std::size_t row, bool down);
+
+    /// \brief  Adds to a row the nodes reached by moving along it
+    /// \param  row The row
+    void FillRow(std::size_t row);
+
+    CoordinateType                     m_width  = 0;        ///< The width of the grid
+    CoordinateType                     m_height = 0;        ///< The height of the grid
+    std::size_t                        m_words  = 0;        ///< The number of words of a row
+    std::size_t                        m_stride = 0;        ///< The words of a row and its padding word
+    std::size_t                        m_size   = 0;        ///< The number of words of a plane
+    std::vector<SDirection>            m_directions;        ///< The directions with at least one move
+    std::vector<std::uint64_t>         m_planes;            ///< The nodes entered by each direction
+    int                                m_east   = -1;       ///< The direction of the moves to the east
+    int                                m_west   = -1;       ///< The direction of the moves to the west
+    bool                               m_diagonal = false;  ///< Tells if a plane holds diagonal moves
+
+    std::vector<std::uint64_t>         m_layer;             ///< The current layer
+    std::vector<std::uint64_t>         m_next;              ///< The next layer
+    std::vector<std::uint64_t>         m_visited;           ///< All reached nodes
+    SBox                               m_dirty;             ///< The words written by the last search
+};
+
+} // !namespace nav
+
+#include "TBitGrid.inl"
+
+#endif // PATHFINDING_T_BIT_GRID_HPP
@@ -0,0 +1,560 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TBitGrid.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <bitset>
+#include <algorithm>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#   include <immintrin.h>
+#endif
+
+/// \namespace nav
+namespace nav
+{
+
+template <typename CoordinateType, typename PriorityType>
+constexpr std::uint32_t TBitGrid<CoordinateType, PriorityType>::UNREACHED;
+
+template <typename CoordinateType, typename PriorityType>
+constexpr std::size_t TBitGrid<CoordinateType, PriorityType>::UNBOUNDED;
+
+/// \brief  Builds the planes of a graph
+/// \param  graph The graph, needs GetNode(x, y) and GetNeighbors
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+void TBitGrid<CoordinateType, PriorityType>::Build(const Graph& graph)
+{
+    m_width  = graph.GetWidth();
+    m_height = graph.GetHeight();
+
+    // A padding word before each row and a padding row above and below,
+    // the shifted loads never leave the planes and never cross rows
+    m_words  = (static_cast<std::size_t>(m_width) + 63) / 64;
+    m_stride = m_words + 1;
+    m_size   = (static_cast<std::size_t>(m_height) + 2) * m_stride + 1;
+
+    // One plane per move, (dx + 1) + (dy + 1) * 3, the center is unused
+    std::vector<std::uint64_t> planes(9 * m_size, 0);
+    bool                       used[9] = { false };
+    std::vector<TTNode>        neighbors;
+
+    for (CoordinateType y = 0; y < m_height; ++y)
+    {
+        for (CoordinateType x = 0; x < m_width; ++x)
+        {
+            neighbors.clear();
+            graph.GetNeighbors(graph.GetNode(x, y), neighbors);
+
+            for (const TTNode& neighbor : neighbors)
+            {
+                const int direction = (neighbor.X() - x + 1) + (neighbor.Y() - y + 1) * 3;
+
+                planes[direction * m_size + GetWordIndex(neighbor.X(), neighbor.Y())] |= std::uint64_t(1) << (neighbor.X() % 64);
+                used[direction] = true;
+            }
+        }
+    }
+
+    m_directions.clear();
+    m_planes.clear();
+    m_east     = -1;
+    m_west     = -1;
+    m_diagonal = false;
+    for (int direction = 0; direction < 9; ++direction)
+    {
+        if (!used[direction])
+            continue;
+
+        const int dx = direction % 3 - 1;
+        const int dy = direction / 3 - 1;
+
+        if (dy == 0)
+            (dx > 0 ? m_east : m_west) = static_cast<int>(m_directions.size());
+        else if (dx != 0)
+            m_diagonal = true;
+
+        m_directions.push_back(SDirection { dx, -dy * static_cast<std::ptrdiff_t>(m_stride), m_planes.size() });
+        m_planes.insert(m_planes.end(), planes.begin() + direction * m_size, planes.begin() + (direction + 1) * m_size);
+    }
+
+    m_layer  .assign(m_size, 0);
+    m_next   .assign(m_size, 0);
+    m_visited.assign(m_size, 0);
+    m_dirty = SBox();
+}
+
+/// \brief  Tells if a node can be reached from another one in a number of moves
+/// \param  from The start node
+/// \param  to The node to reach
+/// \param  steps The maximum number of moves
+/// \return True or false
+template <typename CoordinateType, typename PriorityType>
+bool TBitGrid<CoordinateType, PriorityType>::IsReachableWithin(const TTNode& from, const TTNode& to, std::size_t steps)
+{
+    if (from.X() == to.X() && from.Y() == to.Y())
+        return true;
+
+    // A move changes one coordinate by one, both with diagonal moves
+    const int         dx       = std::abs(to.X() - from.X());
+    const int         dy       = std::abs(to.Y() - from.Y());
+    const std::size_t distance = static_cast<std::size_t>(m_diagonal ? std::max(dx, dy) : dx + dy);
+    if (distance > steps)
+        return false;
+
+    const std::size_t   index = GetWordIndex(to.X(), to.Y());
+    const std::uint64_t mask  = std::uint64_t(1) << (to.X() % 64);
+
+    bool found = false;
+    Spread(from, steps, [&](std::size_t /* step */, const SBox& /* box */)
+    {
+        found = (m_layer[index] & mask) != 0;
+        return !found;
+    }, &to);
+
+    return found;
+}
+
+/// \brief  Computes the number of moves from a node to all nodes in range
+/// \param  from The start node
+/// \param  maxSteps The maximum number of moves
+/// \param  distances The moves per node, indexed by y * width + x, UNREACHED out of range
+/// \return The number of reached nodes, the start node included
+template <typename CoordinateType, typename PriorityType>
+std::size_t TBitGrid<CoordinateType, PriorityType>::GetLayers(const TTNode& from, std::size_t maxSteps, std::vector<std::uint32_t>& distances)
+{
+    distances.assign(static_cast<std::size_t>(m_width) * m_height, UNREACHED);
+    distances[static_cast<std::size_t>(from.Y()) * m_width + from.X()] = 0;
+
+    std::size_t count = 1;
+    Spread(from, maxSteps, [&](std::size_t step, const SBox& box)
+    {
+        for (std::size_t row = box.first_row; row < box.last_row; ++row)
+        {
+            const std::uint64_t* words = m_layer.data() + row * m_stride + 1;
+            std::uint32_t*       line  = distances.data() + (row - 1) * m_width;
+
+            for (std::size_t nWord = box.first_word; nWord < box.last_word; ++nWord)
+            {
+                for (std::uint64_t word = words[nWord]; word != 0; word &= word - 1)
+                {
+                    line[nWord * 64 + GetLowestBit(word)] = static_cast<std::uint32_t>(step);
+                    ++count;
+                }
+            }
+        }
+
+        return true;
+    });
+
+    return count;
+}
+
+/// \brief  Marks all nodes reachable from a node in a number of moves (see IsFilled)
+///         Unbounded fills sweep the rows in place until nothing changes
+/// \param  from The start node
+/// \param  maxSteps The maximum number of moves
+/// \return The number of marked nodes, the start node included
+template <typename CoordinateType, typename PriorityType>
+std::size_t TBitGrid<CoordinateType, PriorityType>::FloodFill(const TTNode& from, std::size_t maxSteps)
+{
+    if (maxSteps != UNBOUNDED)
+    {
+        Spread(from, maxSteps, [](std::size_t /* step */, const SBox& /* box */)
+        {
+            return true;
+        });
+
+        return Count(m_visited, m_dirty);
+    }
+
+    Seed(from);
+    m_dirty = SBox { 1, static_cast<std::size_t>(m_height) + 1, 0, m_words };
+
+    // The rows see the rows swept before them, a path is found
+    // in as many sweeps as it changes its vertical direction
+    FillRow(static_cast<std::size_t>(from.Y()) + 1);
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (std::size_t row = 1; row <= static_cast<std::size_t>(m_height); ++row)
+            changed |= SweepRow(row, true);
+
+        for (std::size_t row = m_height; row >= 1; --row)
+            changed |= SweepRow(row, false);
+    }
+
+    return Count(m_visited, m_dirty);
+}
+
+template <typename CoordinateType, typename PriorityType>
+inline bool TBitGrid<CoordinateType, PriorityType>::IsFilled(CoordinateType x, CoordinateType y) const
+{ return (m_visited[GetWordIndex(x, y)] >> (x % 64)) & 1; }
+
+template <typename CoordinateType, typename PriorityType>
+inline CoordinateType TBitGrid<CoordinateType, PriorityType>::GetWidth() const
+{ return m_width; }
+
+template <typename CoordinateType, typename PriorityType>
+inline CoordinateType TBitGrid<CoordinateType, PriorityType>::GetHeight() const
+{ return m_height; }
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t TBitGrid<CoordinateType, PriorityType>::GetMemoryUsage() const
+{ return (m_planes.size() + 3 * m_size) * sizeof(std::uint64_t) + m_directions.size() * sizeof(SDirection); }
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t TBitGrid<CoordinateType, PriorityType>::GetWordIndex(int x, int y) const
+{ return static_cast<std::size_t>(y + 1) * m_stride + 1 + static_cast<std::size_t>(x) / 64; }
+
+template <typename CoordinateType, typename PriorityType>
+inline unsigned TBitGrid<CoordinateType, PriorityType>::GetLowestBit(std::uint64_t word)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned bit = 0;
+    while (!(word & 1))
+    {
+        word >>= 1;
+        ++bit;
+    }
+
+    return bit;
+#endif
+}
+
+template <typename CoordinateType, typename PriorityType>
+inline void TBitGrid<CoordinateType, PriorityType>::Extend(SBox& box, std::size_t row, std::size_t firstWord, std::size_t lastWord)
+{
+    box.first_row  = std::min(box.first_row,  row);
+    box.last_row   = std::max(box.last_row,   row + 1);
+    box.first_word = std::min(box.first_word, firstWord);
+    box.last_word  = std::max(box.last_word,  lastWord);
+}
+
+/// \brief  Zeroes the words of a box
+template <typename CoordinateType, typename PriorityType>
+void TBitGrid<CoordinateType, PriorityType>::Clear(std::vector<std::uint64_t>& buffer, const SBox& box) const
+{
+    for (std::size_t row = box.first_row; row < box.last_row; ++row)
+    {
+        std::uint64_t* words = buffer.data() + row * m_stride + 1;
+        std::fill(words + box.first_word, words + box.last_word, 0);
+    }
+}
+
+/// \brief  Returns the number of set bits of a box
+template <typename CoordinateType, typename PriorityType>
+std::size_t TBitGrid<CoordinateType, PriorityType>::Count(const std::vector<std::uint64_t>& buffer, const SBox& box) const
+{
+    std::size_t count = 0;
+    for (std::size_t row = box.first_row; row < box.last_row; ++row)
+    {
+        const std::uint64_t* words = buffer.data() + row * m_stride + 1;
+        for (std::size_t nWord = box.first_word; nWord < box.last_word; ++nWord)
+            count += std::bitset<64>(words[nWord]).count();
+    }
+
+    return count;
+}
+
+/// \brief  Clears the last search and marks the start node
+/// \param  from The start node
+/// \return The box of the start node
+template <typename CoordinateType, typename PriorityType>
+typename TBitGrid<CoordinateType, PriorityType>::SBox TBitGrid<CoordinateType, PriorityType>::Seed(const TTNode& from)
+{
+    // Only the words of the last search hold bits
+    Clear(m_layer,   m_dirty);
+    Clear(m_next,    m_dirty);
+    Clear(m_visited, m_dirty);
+
+    const std::size_t   index = GetWordIndex(from.X(), from.Y());
+    const std::uint64_t mask  = std::uint64_t(1) << (from.X() % 64);
+    m_layer  [index] = mask;
+    m_visited[index] = mask;
+
+    const std::size_t row  = static_cast<std::size_t>(from.Y()) + 1;
+    const std::size_t word = static_cast<std::size_t>(from.X()) / 64;
+    m_dirty = SBox { row, row + 1, word, word + 1 };
+    return m_dirty;
+}
+
+/// \brief  Computes the next layer from the current one
+/// \param  range The words that may change
+/// \param  box The bounding box of the next layer
+/// \return true if the layer isn't empty
+template <typename CoordinateType, typename PriorityType>
+bool TBitGrid<CoordinateType, PriorityType>::Expand(const SBox& range, SBox& box)
+{
+    const std::uint64_t* layer   = m_layer.data();
+    const std::uint64_t* planes  = m_planes.data();
+    std::uint64_t*       next    = m_next.data();
+    std::uint64_t*       visited = m_visited.data();
+
+    box = SBox { std::numeric_limits<std::size_t>::max(), 0, std::numeric_limits<std::size_t>::max(), 0 };
+
+    // next = (shifted layer & plane, for each direction) & ~visited
+    for (std::size_t row = range.first_row; row < range.last_row; ++row)
+    {
+        const std::size_t base  = row * m_stride + 1;
+        const std::size_t end   = base + range.last_word;
+        std::size_t       nWord = base + range.first_word;
+
+#if defined(__AVX2__)
+        for (; nWord + 4 <= end; nWord += 4)
+        {
+            __m256i reached = _mm256_setzero_si256();
+            for (const SDirection& direction : m_directions)
+            {
+                const std::uint64_t* source  = layer + nWord + direction.offset;
+                __m256i              shifted = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+
+                if (direction.shift > 0)
+                    shifted = _mm256_or_si256(_mm256_slli_epi64(shifted, 1), _mm256_srli_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source - 1)), 63));
+                else if (direction.shift < 0)
+                    shifted = _mm256_or_si256(_mm256_srli_epi64(shifted, 1), _mm256_slli_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + 1)), 63));
+
+                reached = _mm256_or_si256(reached, _mm256_and_si256(shifted, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(planes + direction.plane + nWord))));
+            }
+
+            const __m256i seen = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(visited + nWord));
+            reached = _mm256_andnot_si256(seen, reached);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(next    + nWord), reached);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(visited + nWord), _mm256_or_si256(seen, reached));
+
+            if (!_mm256_testz_si256(reached, reached))
+                Extend(box, row, nWord - base, nWord - base + 4);
+        }
+#endif
+
+#if defined(__SSE2__)
+        for (; nWord + 2 <= end; nWord += 2)
+        {
+            __m128i reached = _mm_setzero_si128();
+            for (const SDirection& direction : m_directions)
+            {
+                const std::uint64_t* source  = layer + nWord + direction.offset;
+                __m128i              shifted = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+                if (direction.shift > 0)
+                    shifted = _mm_or_si128(_mm_slli_epi64(shifted, 1), _mm_srli_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source - 1)), 63));
+                else if (direction.shift < 0)
+                    shifted = _mm_or_si128(_mm_srli_epi64(shifted, 1), _mm_slli_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 1)), 63));
+
+                reached = _mm_or_si128(reached, _mm_and_si128(shifted, _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + direction.plane + nWord))));
+            }
+
+            const __m128i seen = _mm_loadu_si128(reinterpret_cast<const __m128i*>(visited + nWord));
+            reached = _mm_andnot_si128(seen, reached);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(next    + nWord), reached);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(visited + nWord), _mm_or_si128(seen, reached));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(reached, _mm_setzero_si128())) != 0xFFFF)
+                Extend(box, row, nWord - base, nWord - base + 2);
+        }
+#endif
+
+        // Portable path and the words left by the vectors
+        for (; nWord < end; ++nWord)
+        {
+            std::uint64_t reached = 0;
+            for (const SDirection& direction : m_directions)
+            {
+                const std::uint64_t* source  = layer + nWord + direction.offset;
+                std::uint64_t        shifted = source[0];
+
+                if (direction.shift > 0)
+                    shifted = (shifted << 1) | (source[-1] >> 63);
+                else if (direction.shift < 0)
+                    shifted = (shifted >> 1) | (source[1] << 63);
+
+                reached |= shifted & planes[direction.plane + nWord];
+            }
+
+            reached        &= ~visited[nWord];
+            next   [nWord]  = reached;
+            visited[nWord] |= reached;
+
+            if (reached != 0)
+                Extend(box, row, nWord - base, nWord - base + 1);
+        }
+    }
+
+    return box.last_row != 0;
+}
+
+/// \brief  Computes layers until the visitor stops or the layer is empty
+/// \param  from The start node
+/// \param  maxSteps The maximum number of layers
+/// \param  visitor Called with the step and the box of each layer, returns false to stop
+/// \param  target The only node to reach if not null, the nodes too far from it are skipped
+template <typename CoordinateType, typename PriorityType>
+template <typename Visitor>
+void TBitGrid<CoordinateType, PriorityType>::Spread(const TTNode& from, std::size_t maxSteps, Visitor visitor, const TTNode* target)
+{
+    SBox layer_box = Seed(from);
+    SBox next_box;
+
+    for (std::size_t step = 1; step <= maxSteps; ++step)
+    {
+        // A move reaches the rows and the words next to the layer
+        SBox range;
+        range.first_row  = std::max<std::size_t>(layer_box.first_row, 2) - 1;
+        range.last_row   = std::min<std::size_t>(layer_box.last_row + 1, static_cast<std::size_t>(m_height) + 1);
+        range.first_word = std::max<std::size_t>(layer_box.first_word, 1) - 1;
+        range.last_word  = std::min<std::size_t>(layer_box.last_word + 1, m_words);
+
+        if (target)
+        {
+            // The nodes of this layer must reach the target with the moves left
+            const std::size_t left = maxSteps - step;
+            const std::size_t row  = static_cast<std::size_t>(target->Y()) + 1;
+            const std::size_t x    = static_cast<std::size_t>(target->X());
+
+            range.first_row  = std::max(range.first_row,  row > left ? row - left : 0);
+            range.last_row   = std::min(range.last_row,   row + left + 1);
+            range.first_word = std::max(range.first_word, (x > left ? x - left : 0) / 64);
+            range.last_word  = std::min(range.last_word,  (x + left) / 64 + 1);
+
+            if (range.first_row >= range.last_row || range.first_word >= range.last_word)
+                return;
+        }
+
+        m_dirty.first_row  = std::min(m_dirty.first_row,  range.first_row);
+        m_dirty.last_row   = std::max(m_dirty.last_row,   range.last_row);
+        m_dirty.first_word = std::min(m_dirty.first_word, range.first_word);
+        m_dirty.last_word  = std::max(m_dirty.last_word,  range.last_word);
+
+        // The next buffer still holds the layer before the current one
+        Clear(m_next, next_box);
+        if (!Expand(range, next_box))
+            return;
+
+        m_layer.swap(m_next);
+        std::swap(layer_box, next_box);
+        if (!visitor(step, layer_box))
+            return;
+    }
+}
+
+/// \brief  Adds to a row the nodes entered from the row before it in a sweep
+/// \param  row The row
+/// \param  down true for the moves going down, false for the ones going up
+/// \return true if the row changed
+template <typename CoordinateType, typename PriorityType>
+bool TBitGrid<CoordinateType, PriorityType>::SweepRow(std::size_t row, bool down)
+{
+    const std::uint64_t* planes  = m_planes.data();
+    std::uint64_t*       visited = m_visited.data();
+    std::uint64_t        added   = 0;
+
+    // The visited nodes of the rows already swept are the layer
+    const std::size_t end = row * m_stride + 1 + m_words;
+    for (std::size_t nWord = row * m_stride + 1; nWord < end; ++nWord)
+    {
+        std::uint64_t reached = 0;
+        for (const SDirection& direction : m_directions)
+        {
+            if (direction.offset == 0 || (direction.offset < 0) != down)
+                continue;
+
+            const std::uint64_t* source  = visited + nWord + direction.offset;
+            std::uint64_t        shifted = source[0];
+
+            if (direction.shift > 0)
+                shifted = (shifted << 1) | (source[-1] >> 63);
+            else if (direction.shift < 0)
+                shifted = (shifted >> 1) | (source[1] << 63);
+
+            reached |= shifted & planes[direction.plane + nWord];
+        }
+
+        reached        &= ~visited[nWord];
+        visited[nWord] |= reached;
+        added          |= reached;
+    }
+
+    if (added == 0)
+        return false;
+
+    FillRow(row);
+    return true;
+}
+
+/// \brief  Adds to a row the nodes reached by moving along it
+/// \param  row The row
+template <typename CoordinateType, typename PriorityType>
+void TBitGrid<CoordinateType, PriorityType>::FillRow(std::size_t row)
+{
+    std::uint64_t*       words = m_visited.data() + row * m_stride + 1;
+    const std::uint64_t* east  = m_east < 0 ? nullptr : m_planes.data() + m_directions[m_east].plane + row * m_stride + 1;
+    const std::uint64_t* west  = m_west < 0 ? nullptr : m_planes.data() + m_directions[m_west].plane + row * m_stride + 1;
+
+    // Occluded fills, the open runs are crossed in log2(64) shifts
+    // per word and the last bit is carried to the next word
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+
+        std::uint64_t carry = 0;
+        for (std::size_t nWord = 0; east && nWord < m_words; ++nWord)
+        {
+            std::uint64_t open = east[nWord];
+            std::uint64_t fill = words[nWord] | (open & carry);
+
+            fill |= open & (fill <<  1); open &= open <<  1;
+            fill |= open & (fill <<  2); open &= open <<  2;
+            fill |= open & (fill <<  4); open &= open <<  4;
+            fill |= open & (fill <<  8); open &= open <<  8;
+            fill |= open & (fill << 16); open &= open << 16;
+            fill |= open & (fill << 32);
+
+            changed      |= fill != words[nWord];
+            words[nWord]  = fill;
+            carry         = fill >> 63;
+        }
+
+        carry = 0;
+        for (std::size_t nWord = m_words; west && nWord-- > 0;)
+        {
+            std::uint64_t open = west[nWord];
+            std::uint64_t fill = words[nWord] | (open & carry);
+
+            fill |= open & (fill >>  1); open &= open >>  1;
+            fill |= open & (fill >>  2); open &= open >>  2;
+            fill |= open & (fill >>  4); open &= open >>  4;
+            fill |= open & (fill >>  8); open &= open >>  8;
+            fill |= open & (fill >> 16); open &= open >> 16;
+            fill |= open & (fill >> 32);
+
+            changed      |= fill != words[nWord];
+            words[nWord]  = fill;
+            carry         = (fill & 1) << 63;
+        }
+    }
+}
+
+} // !namespace nav
@@ -0,0 +1,238 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TChunkedGrid.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_CHUNKED_GRID_HPP
+#define PATHFINDING_T_CHUNKED_GRID_HPP
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <limits>
+#include <cstdlib>
+#include <condition_variable>
+
+#include "TNode.hpp"
+#include "TMapFile.hpp"
+#include "TMoveRules.hpp"
+#include "TMovePolicy.hpp"
+#include "TSearchEntries.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TChunkedGrid
+/// \brief  Read only grid paged in from a chunked map file
+///
+///         Only a budget of chunks is resident, the least recently used
+///         one is evicted to make room. When a search reaches the margin
+///         of a chunk, the chunks across the border are queued to a
+///         loader thread so they are usually resident before the search
+///         enters them. A chunk that is still missing is loaded in place,
+///         which counts as a stall.
+///
+///         Nodes are returned by value. The grid is searched by one
+///         thread at a time. Node indices run chunk by chunk and the
+///         searches store their visited nodes in pages allocated on first
+///         touch (see TPagedEntries) : the memory of a search follows the
+///         area it explores, not the size of the grid.
+///
+/// \tparam CoordinateType The type of the coordinate system
+/// \tparam PriorityType   The type of the priority
+/// \tparam Moves          The move policy (see TMovePolicy.hpp)
+template <typename CoordinateType, typename PriorityType, typename Moves = TFourWayMoves<PriorityType>>
+class TChunkedGrid
+{
+public:
+
+    using TTNode  = TNode<CoordinateType, PriorityType>;
+    using TTMoves = Moves;
+
+    /// \brief  The smallest budget, a node and its neighbors span 4 chunks
+    ///         and the chunks around them must not evict each other
+    static constexpr std::size_t MIN_BUDGET = 9;
+
+    /// \brief  Creates a closed grid
+    TChunkedGrid() = default;
+
+    /// \brief  Stops the loader and closes the file
+    ~TChunkedGrid();
+
+    TChunkedGrid(const TChunkedGrid&)            = delete;
+    TChunkedGrid& operator=(const TChunkedGrid&) = delete;
+
+    /// \brief  Opens a chunked map file, no chunk is loaded yet
+    /// \param  path The path of the file (see SaveChunkedMapFile)
+    /// \param  budget The maximum number of resident chunks
+    /// \param  margin The distance to a chunk border that triggers prefetching
+    /// \return false if the file can't be read or isn't a valid chunked map file
+    bool Open(const char* path, std::size_t budget, int margin = 8);
+
+    /// \brief  Stops the loader, drops all chunks and closes the file
+    void Close();
+
+    /// \brief  Puts into the current node neighbors all direct neighbors,
+    ///         followed by the diagonal ones if the move policy allows them
+    /// \param  current The node to check
+    /// \param  neighbors The vector of neighbors
+    inline void GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const;
+
+    /// \brief  Returns the cost to move from a node to one of its neighbors
+    inline PriorityType GetCost(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Returns the terrain cost of a node
+    inline unsigned char GetNodeCost(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns a node
+    inline TTNode GetNode(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns a node from its index
+    inline TTNode GetNodeAt(std::size_t index) const;
+
+    /// \brief  Returns the index of a node in the grid,
+    ///         chunk * chunk_size^2 + its index inside the chunk
+    inline std::size_t GetNodeIndex(const TTNode& node) const;
+
+    /// \brief  Returns the number of nodes of the grid, the padding
+    ///         of the chunks crossing the border included
+    inline std::size_t GetNodeCount() const;
+
+    /// \brief  Returns the width of the grid
+    inline CoordinateType GetWidth() const;
+
+    /// \brief  Returns the height of the grid
+    inline CoordinateType GetHeight() const;
+
+    /// \brief  Tells if two nodes are in the same connected component
+    inline bool IsReachable(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Returns the connected component label of a node
+    inline std::uint32_t GetComponent(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  The grid is read only, the epochs never change
+    inline std::uint32_t GetEpoch() const;
+    inline std::uint32_t GetNodeEpoch(std::size_t index) const;
+
+    /// \brief  Tells if the node is valid or node
+    inline bool IsValidNode(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Queues the chunk holding a node to the loader
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    void Prefetch(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns the number of resident or queued chunks
+    inline std::size_t GetResidentCount() const;
+
+    /// \brief  Returns the number of chunks loaded since Open
+    inline std::size_t GetLoadCount() const;
+
+    /// \brief  Returns the number of times a search waited for a chunk
+    inline std::size_t GetStallCount() const;
+
+private:
+
+    using TTMoveRules = TMoveRules<TTNode, Moves>;
+
+    /// \brief  The life of a chunk
+    enum EState : int
+    {
+        EMPTY   = 0, ///< Not in memory
+        QUEUED  = 1, ///< Waiting for the loader
+        LOADING = 2, ///< Being read, owned by the reader
+        READY   = 3  ///< In memory
+    };
+
+    /// \brief  A chunk and its residency data
+    struct SChunk
+    {
+        std::atomic<int>                 state    { EMPTY }; ///< See EState
+        std::unique_ptr<unsigned char[]> data;               ///< Flags, costs and components
+        std::uint64_t                    last_use = 0;       ///< The tick of the last access
+    };
+
+    /// \brief  Returns the data of a chunk, loads it if needed
+    const unsigned char* Acquire(std::size_t chunk) const;
+
+    /// \brief  Frees the least recently used chunk, called with the lock held
+    /// \return false if no chunk can be evicted
+    bool Evict() const;
+
+    /// \brief  Reads a chunk from a file
+    bool Load(std::FILE* file, std::size_t chunk) const;
+
+    /// \brief  Loop of the loader thread
+    void LoaderLoop();
+
+    /// \brief  Returns the index of the chunk holding a node
+    inline std::size_t GetChunkIndex(int x, int y) const;
+
+    /// \brief  Returns the index of a node inside its chunk
+    inline std::size_t GetLocalIndex(int x, int y) const;
+
+    /// \brief  Returns the neighbor flags of a node
+    inline unsigned char GetFlags(int x, int y) const;
+
+    CoordinateType                   m_width        = 0;       ///< The width of the grid
+    CoordinateType                   m_height       = 0;       ///< The height of the grid
+    int                              m_chunk_size   = 0;       ///< The width and height of a chunk
+    int                              m_chunks_x     = 0;       ///< The number of chunks on X
+    int                              m_chunks_y     = 0;       ///< The number of chunks on Y
+    std::uint64_t                    m_chunk_bytes  = 0;       ///< The size of a chunk
+    std::uint64_t                    m_data_offset  = 0;       ///< The offset of the first chunk
+    std::size_t                      m_budget       = 0;       ///< The maximum number of resident chunks
+    int                              m_margin       = 0;       ///< The distance that triggers prefetching
+
+    std::unique_ptr<SChunk[]>        m_chunks;                 ///< All chunks
+    mutable std::vector<std::size_t> m_resident;               ///< The chunks that aren't empty
+    mutable std::uint64_t            m_tick         = 0;       ///< The access clock
+    mutable std::size_t              m_loads        = 0;       ///< The number of loaded chunks
+    mutable std::size_t              m_stalls       = 0;       ///< The number of waits
+    std::FILE*                       mp_file        = nullptr; ///< Read by the searching thread
+    std::FILE*                       mp_loader_file = nullptr; ///< Read by the loader thread
+
+    mutable std::mutex               m_mutex;                  ///< Protects the states and the queue
+    mutable std::condition_variable  m_wake;                   ///< Signaled on request or stop
+    mutable std::condition_variable  m_loaded;                 ///< Signaled when a chunk is ready
+    mutable std::deque<std::size_t>  m_requests;               ///< The chunks to load
+    std::thread                      m_loader;                 ///< The loader thread
+    bool                             m_stop         = false;   ///< Tells the loader to exit
+};
+
+/// \brief  Searches on a chunked grid store their visited nodes in pages,
+///         only the page table spans the whole grid
+template <typename CoordinateType, typename GridPriorityType, typename Moves, typename PriorityType, typename Allocator>
+struct TGraphEntries<TChunkedGrid<CoordinateType, GridPriorityType, Moves>, PriorityType, Allocator>
+{
+    using TTEntries = TPagedEntries<PriorityType, Allocator>;
+};
+
+} // !namespace nav
+
+#include "TChunkedGrid.inl"
+
+#endif // PATHFINDING_T_CHUNKED_GRID_HPP
@@ -0,0 +1,438 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TChunkedGrid.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cstring>
+#include <algorithm>
+
+/// \namespace nav
+namespace nav
+{
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+constexpr std::size_t TChunkedGrid<CoordinateType, PriorityType, Moves>::MIN_BUDGET;
+
+/// \brief  Stops the loader and closes the file
+template <typename CoordinateType, typename PriorityType, typename Moves>
+TChunkedGrid<CoordinateType, PriorityType, Moves>::~TChunkedGrid()
+{
+    Close();
+}
+
+/// \brief  Opens a chunked map file, no chunk is loaded yet
+/// \param  path The path of the file (see SaveChunkedMapFile)
+/// \param  budget The maximum number of resident chunks
+/// \param  margin The distance to a chunk border that triggers prefetching
+/// \return false if the file can't be read or isn't a valid chunked map file
+template <typename CoordinateType, typename PriorityType, typename Moves>
+bool TChunkedGrid<CoordinateType, PriorityType, Moves>::Open(const char* path, std::size_t budget, int margin)
+{
+    Close();
+
+    mp_file = std::fopen(path, "rb");
+    if (mp_file == nullptr)
+        return false;
+
+    SChunkedMapFileHeader header;
+    const bool read = std::fread(&header, 1, sizeof(header), mp_file) == sizeof(header);
+
+    const std::uint64_t chunk_count = read ? static_cast<std::uint64_t>(header.chunks_x) * header.chunks_y : 0;
+    const bool valid = read
+                    && std::memcmp(header.magic, "NAVC", 4) == 0
+                    && header.version    == MAP_FILE_VERSION
+                    && header.chunk_size != 0
+                    && header.width      <= static_cast<std::uint64_t>(std::numeric_limits<CoordinateType>::max())
+                    && header.height     <= static_cast<std::uint64_t>(std::numeric_limits<CoordinateType>::max())
+                    && header.chunks_x   == (header.width  + header.chunk_size - 1) / header.chunk_size
+                    && header.chunks_y   == (header.height + header.chunk_size - 1) / header.chunk_size
+                    && header.chunk_bytes == GetChunkComponentsOffset(header.chunk_size) + static_cast<std::uint64_t>(header.chunk_size) * header.chunk_size * sizeof(std::uint32_t)
+                    && header.size        == header.data_offset + header.chunk_bytes * chunk_count;
+
+    mp_loader_file = valid ? std::fopen(path, "rb") : nullptr;
+    if (mp_loader_file == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    m_width       = static_cast<CoordinateType>(header.width);
+    m_height      = static_cast<CoordinateType>(header.height);
+    m_chunk_size  = static_cast<int>(header.chunk_size);
+    m_chunks_x    = static_cast<int>(header.chunks_x);
+    m_chunks_y    = static_cast<int>(header.chunks_y);
+    m_chunk_bytes = header.chunk_bytes;
+    m_data_offset = header.data_offset;
+    m_budget      = std::max(budget, MIN_BUDGET);
+    m_margin      = margin;
+
+    m_chunks.reset(new SChunk[static_cast<std::size_t>(chunk_count)]);
+    m_resident.reserve(m_budget + 1);
+
+    m_loader = std::thread(&TChunkedGrid::LoaderLoop, this);
+    return true;
+}
+
+/// \brief  Stops the loader, drops all chunks and closes the file
+template <typename CoordinateType, typename PriorityType, typename Moves>
+void TChunkedGrid<CoordinateType, PriorityType, Moves>::Close()
+{
+    if (m_loader.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+
+        m_wake.notify_all();
+        m_loader.join();
+    }
+
+    if (mp_file        != nullptr) std::fclose(mp_file);
+    if (mp_loader_file != nullptr) std::fclose(mp_loader_file);
+
+    mp_file        = nullptr;
+    mp_loader_file = nullptr;
+    m_stop         = false;
+    m_width        = 0;
+    m_height       = 0;
+    m_loads        = 0;
+    m_stalls       = 0;
+
+    m_chunks.reset();
+    m_resident.clear();
+    m_requests.clear();
+}
+
+/// \brief  Puts into the current node neighbors all direct neighbors,
+///         followed by the diagonal ones if the move policy allows them
+/// \param  current The node to check
+/// \param  neighbors The vector of neighbors
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline void TChunkedGrid<CoordinateType, PriorityType, Moves>::GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const
+{
+    const int x = current.X();
+    const int y = current.Y();
+
+    TTMoveRules::GetNeighbors(x, y, GetFlags(x, y),
+        [this](int fx, int fy) -> unsigned char
+        { return IsValidNode(static_cast<CoordinateType>(fx), static_cast<CoordinateType>(fy)) ? GetFlags(fx, fy) : 0; },
+        [this](int fx, int fy, unsigned char /* flags */)
+        { return GetNode(static_cast<CoordinateType>(fx), static_cast<CoordinateType>(fy)); },
+        neighbors);
+
+    // Close to the border of the chunk, the next chunks are loaded ahead
+    const int lx = x % m_chunk_size;
+    const int ly = y % m_chunk_size;
+    const int px = lx < m_margin ? -1 : (lx >= m_chunk_size - m_margin ? 1 : 0);
+    const int py = ly < m_margin ? -1 : (ly >= m_chunk_size - m_margin ? 1 : 0);
+
+    if (px != 0)            Prefetch(static_cast<CoordinateType>(x + px * m_margin), static_cast<CoordinateType>(y));
+    if (py != 0)            Prefetch(static_cast<CoordinateType>(x),                 static_cast<CoordinateType>(y + py * m_margin));
+    if (px != 0 && py != 0) Prefetch(static_cast<CoordinateType>(x + px * m_margin), static_cast<CoordinateType>(y + py * m_margin));
+}
+
+/// \brief  Returns the cost to move from a node to one of its neighbors
+///         The terrain cost of the neighbor scaled by the move length
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline PriorityType TChunkedGrid<CoordinateType, PriorityType, Moves>::GetCost(const TTNode& from, const TTNode& to) const
+{
+    const PriorityType cost = GetNodeCost(to.X(), to.Y());
+
+    if (Moves::DIAGONAL && from.X() != to.X() && from.Y() != to.Y())
+        return cost * Moves::DIAGONAL_COST;
+
+    return cost * Moves::STRAIGHT_COST;
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline unsigned char TChunkedGrid<CoordinateType, PriorityType, Moves>::GetNodeCost(CoordinateType x, CoordinateType y) const
+{
+    const std::size_t count = static_cast<std::size_t>(m_chunk_size) * m_chunk_size;
+    return Acquire(GetChunkIndex(x, y))[count + GetLocalIndex(x, y)];
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline TNode<CoordinateType, PriorityType> TChunkedGrid<CoordinateType, PriorityType, Moves>::GetNode(CoordinateType x, CoordinateType y) const
+{
+    TTNode node(x, y);
+    node.SetNeighborFlag(GetFlags(x, y));
+    return node;
+}
+
+/// \brief  Returns a node from its index, chunk by chunk
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline TNode<CoordinateType, PriorityType> TChunkedGrid<CoordinateType, PriorityType, Moves>::GetNodeAt(std::size_t index) const
+{
+    const std::size_t count = static_cast<std::size_t>(m_chunk_size) * m_chunk_size;
+    const std::size_t chunk = index / count;
+    const std::size_t local = index % count;
+
+    return GetNode(static_cast<CoordinateType>((chunk % m_chunks_x) * m_chunk_size + local % m_chunk_size),
+                   static_cast<CoordinateType>((chunk / m_chunks_x) * m_chunk_size + local / m_chunk_size));
+}
+
+/// \brief  Returns the index of a node, the nodes of a chunk are
+///         numbered together so searches touch few pages (see TPagedEntries)
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetNodeIndex(const TTNode& node) const
+{ return GetChunkIndex(node.X(), node.Y()) * m_chunk_size * m_chunk_size + GetLocalIndex(node.X(), node.Y()); }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetNodeCount() const
+{ return static_cast<std::size_t>(m_chunks_x) * m_chunks_y * m_chunk_size * m_chunk_size; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline CoordinateType TChunkedGrid<CoordinateType, PriorityType, Moves>::GetWidth() const
+{ return m_width; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline CoordinateType TChunkedGrid<CoordinateType, PriorityType, Moves>::GetHeight() const
+{ return m_height; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline bool TChunkedGrid<CoordinateType, PriorityType, Moves>::IsReachable(const TTNode& from, const TTNode& to) const
+{ return GetComponent(from.X(), from.Y()) == GetComponent(to.X(), to.Y()); }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetComponent(CoordinateType x, CoordinateType y) const
+{
+    const unsigned char* components = Acquire(GetChunkIndex(x, y)) + GetChunkComponentsOffset(static_cast<std::uint32_t>(m_chunk_size));
+    return reinterpret_cast<const std::uint32_t*>(components)[GetLocalIndex(x, y)];
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetEpoch() const
+{ return 0; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetNodeEpoch(std::size_t /* index */) const
+{ return 0; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline bool TChunkedGrid<CoordinateType, PriorityType, Moves>::IsValidNode(CoordinateType x, CoordinateType y) const
+{ return (x >= 0 && x < m_width && y >= 0 && y < m_height); }
+
+/// \brief  Queues the chunk holding a node to the loader
+///         Nothing is done if it is already resident or queued
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+template <typename CoordinateType, typename PriorityType, typename Moves>
+void TChunkedGrid<CoordinateType, PriorityType, Moves>::Prefetch(CoordinateType x, CoordinateType y) const
+{
+    if (!IsValidNode(x, y))
+        return;
+
+    const std::size_t chunk = GetChunkIndex(x, y);
+    SChunk&           entry = m_chunks[chunk];
+
+    if (entry.state.load(std::memory_order_acquire) != EMPTY)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // A prefetch never goes over the budget
+        if (m_resident.size() >= m_budget && !Evict())
+            return;
+
+        entry.state.store(QUEUED, std::memory_order_release);
+        entry.last_use = ++m_tick;
+        m_resident.push_back(chunk);
+        m_requests.push_back(chunk);
+    }
+
+    m_wake.notify_one();
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetResidentCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_resident.size();
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetLoadCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_loads;
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetStallCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stalls;
+}
+
+/// \brief  Returns the data of a chunk, loads it if needed
+///         Only the searching thread evicts, a ready chunk stays valid
+///         until its next call
+/// \param  chunk The index of the chunk
+/// \return The flags, costs and components of the chunk
+template <typename CoordinateType, typename PriorityType, typename Moves>
+const unsigned char* TChunkedGrid<CoordinateType, PriorityType, Moves>::Acquire(std::size_t chunk) const
+{
+    SChunk& entry = m_chunks[chunk];
+
+    if (entry.state.load(std::memory_order_acquire) != READY)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (entry.state.load(std::memory_order_acquire) != READY)
+        {
+            ++m_stalls;
+
+            // The loader is on it
+            if (entry.state.load(std::memory_order_relaxed) == LOADING)
+            {
+                m_loaded.wait(lock);
+                continue;
+            }
+
+            if (entry.state.load(std::memory_order_relaxed) == EMPTY)
+            {
+                if (m_resident.size() >= m_budget)
+                    Evict();
+
+                m_resident.push_back(chunk);
+            }
+
+            // Empty or still queued, read here, the loader will skip it
+            entry.state.store(LOADING, std::memory_order_relaxed);
+
+            lock.unlock();
+            Load(mp_file, chunk);
+            lock.lock();
+
+            entry.state.store(READY, std::memory_order_release);
+            ++m_loads;
+            m_loaded.notify_all();
+        }
+    }
+
+    entry.last_use = ++m_tick;
+    return entry.data.get();
+}
+
+/// \brief  Frees the least recently used chunk, called with the lock held
+///         Chunks being loaded are never evicted
+/// \return false if no chunk can be evicted
+template <typename CoordinateType, typename PriorityType, typename Moves>
+bool TChunkedGrid<CoordinateType, PriorityType, Moves>::Evict() const
+{
+    std::size_t victim = m_resident.size();
+
+    for (std::size_t n = 0; n < m_resident.size(); ++n)
+    {
+        const SChunk& candidate = m_chunks[m_resident[n]];
+        if (candidate.state.load(std::memory_order_relaxed) == LOADING)
+            continue;
+
+        if (victim == m_resident.size() || candidate.last_use < m_chunks[m_resident[victim]].last_use)
+            victim = n;
+    }
+
+    if (victim == m_resident.size())
+        return false;
+
+    // A queued chunk is skipped by the loader once empty
+    SChunk& entry = m_chunks[m_resident[victim]];
+    entry.state.store(EMPTY, std::memory_order_relaxed);
+    entry.data.reset();
+
+    m_resident[victim] = m_resident.back();
+    m_resident.pop_back();
+    return true;
+}
+
+/// \brief  Reads a chunk from a file
+///         A chunk that can't be read is seen as blocked
+/// \param  file The file to read from, owned by the calling thread
+/// \param  chunk The index of the chunk
+/// \return false if the chunk can't be read
+template <typename CoordinateType, typename PriorityType, typename Moves>
+bool TChunkedGrid<CoordinateType, PriorityType, Moves>::Load(std::FILE* file, std::size_t chunk) const
+{
+    SChunk& entry = m_chunks[chunk];
+    entry.data.reset(new unsigned char[static_cast<std::size_t>(m_chunk_bytes)]);
+
+    const std::uint64_t offset = m_data_offset + m_chunk_bytes * chunk;
+
+#if defined(_WIN32)
+    const bool seek = _fseeki64(file, static_cast<long long>(offset), SEEK_SET) == 0;
+#else
+    const bool seek = fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+
+    if (seek && std::fread(entry.data.get(), 1, static_cast<std::size_t>(m_chunk_bytes), file) == m_chunk_bytes)
+        return true;
+
+    std::memset(entry.data.get(), 0, static_cast<std::size_t>(m_chunk_bytes));
+    return false;
+}
+
+/// \brief  Loop of the loader thread
+template <typename CoordinateType, typename PriorityType, typename Moves>
+void TChunkedGrid<CoordinateType, PriorityType, Moves>::LoaderLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_wake.wait(lock, [this] { return m_stop || !m_requests.empty(); });
+
+        if (m_stop)
+            return;
+
+        const std::size_t chunk = m_requests.front();
+        m_requests.pop_front();
+
+        // Evicted or taken by the searching thread in the meantime
+        SChunk& entry = m_chunks[chunk];
+        if (entry.state.load(std::memory_order_relaxed) != QUEUED)
+            continue;
+
+        entry.state.store(LOADING, std::memory_order_relaxed);
+
+        lock.unlock();
+        Load(mp_loader_file, chunk);
+        lock.lock();
+
+        entry.state.store(READY, std::memory_order_release);
+        ++m_loads;
+        m_loaded.notify_all();
+    }
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetChunkIndex(int x, int y) const
+{ return static_cast<std::size_t>(y / m_chunk_size) * m_chunks_x + x / m_chunk_size; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TChunkedGrid<CoordinateType, PriorityType, Moves>::GetLocalIndex(int x, int y) const
+{ return static_cast<std::size_t>(y % m_chunk_size) * m_chunk_size + x % m_chunk_size; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline unsigned char TChunkedGrid<CoordinateType, PriorityType, Moves>::GetFlags(int x, int y) const
+{ return Acquire(GetChunkIndex(x, y))[GetLocalIndex(x, y)]; }
+
+} // !namespace nav
@@ -0,0 +1,170 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TCompactGrid.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_COMPACT_GRID_HPP
+#define PATHFINDING_T_COMPACT_GRID_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+#include "TNode.hpp"
+#include "TMoveRules.hpp"
+#include "TMovePolicy.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TCompactGrid
+/// \brief  Stores a 2D square grid as its neighbor flags only
+///
+///         A 4 way grid packs two nodes per byte, an 8 way grid uses
+///         one byte per node. The flags are framed by empty slots so
+///         the neighbor lookups have no bound checks. Coordinates follow from the index and the
+///         priority only lives in the open list, so nodes are built on
+///         the fly and returned by value.
+///
+///         Terrain costs take one more byte per node once a cost other
+///         than 1 is set. Component labels take 4 bytes per node and are
+///         only kept between UpdateComponents and the next edit of the
+///         moves : without them every node is seen as reachable.
+///         Every edit bumps the epoch of every node, cached paths are
+///         checked again after any edit.
+///
+/// \tparam CoordinateType The type of the coordinate system
+/// \tparam PriorityType   The type of the priority
+/// \tparam Moves          The move policy (see TMovePolicy.hpp)
+template <typename CoordinateType, typename PriorityType, typename Moves = TFourWayMoves<PriorityType>>
+class TCompactGrid
+{
+public:
+
+    using TTNode  = TNode<CoordinateType, PriorityType>;
+    using TTMoves = Moves;
+
+    /// \brief  Initializes a grid width x height, nodes have no neighbors
+    /// \param  width The width of the grid
+    /// \param  height The height of the grid
+    void Initialize(CoordinateType width, CoordinateType height);
+
+    /// \brief  Puts into the current node neighbors all direct neighbors,
+    ///         followed by the diagonal ones if the move policy allows them
+    /// \param  current The node to check
+    /// \param  neighbors The vector of neighbors
+    inline void GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const;
+
+    /// \brief  Returns the cost to move from a node to one of its neighbors
+    /// \param  from The current node
+    /// \param  to The neighbor
+    /// \return The cost of the move
+    inline PriorityType GetCost(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Sets the terrain cost of a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  cost The cost to enter the node, at least 1
+    void SetNodeCost(CoordinateType x, CoordinateType y, unsigned char cost);
+
+    /// \brief  Returns the terrain cost of a node
+    inline unsigned char GetNodeCost(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \return A node
+    inline TTNode GetNode(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns a node from its index
+    /// \param  index The index of the node (see GetNodeIndex)
+    /// \return A node
+    inline TTNode GetNodeAt(std::size_t index) const;
+
+    /// \brief  Returns the index of a node in the grid (y * width + x)
+    inline std::size_t GetNodeIndex(const TTNode& node) const;
+
+    /// \brief  Returns the number of nodes of the grid
+    inline std::size_t GetNodeCount() const;
+
+    /// \brief  Returns the width of the grid
+    inline CoordinateType GetWidth() const;
+
+    /// \brief  Returns the height of the grid
+    inline CoordinateType GetHeight() const;
+
+    /// \brief  Sets the neighbors of a node,
+    ///         drops the component labels if a straight edge changed
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  flag The flag to apply
+    void SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag);
+
+    /// \brief  Labels the connected components, call it after the edits
+    void UpdateComponents();
+
+    /// \brief  Tells if a path may exist between two nodes
+    ///         Always true while the components aren't labeled
+    inline bool IsReachable(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Returns the connected component label of a node,
+    ///         0 while the components aren't labeled
+    inline std::uint32_t GetComponent(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns the edit epoch, bumped by every edit of the grid
+    inline std::uint32_t GetEpoch() const;
+
+    /// \brief  Nodes aren't stamped, returns the epoch of the last edit
+    inline std::uint32_t GetNodeEpoch(std::size_t index) const;
+
+    /// \brief  Tells if the node is valid or node
+    inline bool IsValidNode(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns the number of bytes used by the grid
+    inline std::size_t GetMemoryUsage() const;
+
+private:
+
+    using TTMoveRules = TMoveRules<TTNode, Moves>;
+
+    /// \brief  The number of nodes per byte
+    static constexpr std::size_t NODES_PER_BYTE = Moves::DIAGONAL ? 1 : 2;
+
+    /// \brief  Returns the neighbor flags of a node, 0 for the border slots
+    inline unsigned char GetFlags(int x, int y) const;
+
+    /// \brief  Returns the slot of a node in the packed flags, x and y may
+    ///         be one step outside of the grid
+    inline std::size_t GetSlot(int x, int y) const;
+
+    CoordinateType                m_width  = 0; ///< The width of the grid
+    CoordinateType                m_height = 0; ///< The height of the grid
+    std::vector < unsigned char > m_flags;      ///< The packed neighbor flags
+    std::vector < unsigned char > m_costs;      ///< The terrain costs, empty while all are 1
+    std::vector < std::uint32_t > m_components; ///< The component labels, empty if stale
+    std::uint32_t                 m_epoch  = 0; ///< The edit epoch
+};
+
+} // !namespace nav
+
+#include "TCompactGrid.inl"
+
+#endif // PATHFINDING_T_COMPACT_GRID_HPP
@@ -0,0 +1,259 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TCompactGrid.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <algorithm>
+
+/// \namespace nav
+namespace nav
+{
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+constexpr std::size_t TCompactGrid<CoordinateType, PriorityType, Moves>::NODES_PER_BYTE;
+
+/// \brief  Initializes a grid width x height, nodes have no neighbors
+/// \param  width The width of the grid
+/// \param  height The height of the grid
+template <typename CoordinateType, typename PriorityType, typename Moves>
+void TCompactGrid<CoordinateType, PriorityType, Moves>::Initialize(CoordinateType width, CoordinateType height)
+{
+    m_width  = width;
+    m_height = height;
+
+    // One empty row above and below, one empty column shared by the
+    // end of a row and the start of the next one : no bound checks
+    const std::size_t count = (static_cast<std::size_t>(height) + 2) * (static_cast<std::size_t>(width) + 1) + 1;
+    m_flags.assign((count + NODES_PER_BYTE - 1) / NODES_PER_BYTE, 0);
+    m_costs.clear();
+    m_components.clear();
+
+    // A new grid, everything cached on the previous one is stale
+    ++m_epoch;
+}
+
+/// \brief  Puts into the current node neighbors all direct neighbors,
+///         followed by the diagonal ones if the move policy allows them
+/// \param  current The node to check
+/// \param  neighbors The vector of neighbors
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline void TCompactGrid<CoordinateType, PriorityType, Moves>::GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const
+{
+    // Neighbors of a node are nodes or border slots, no bound check
+    TTMoveRules::GetNeighbors(current.X(), current.Y(), GetFlags(current.X(), current.Y()),
+        [this](int x, int y) -> unsigned char
+        { return GetFlags(x, y); },
+        [](int x, int y, unsigned char flags)
+        {
+            TTNode node(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y));
+            node.SetNeighborFlag(flags);
+            return node;
+        },
+        neighbors);
+}
+
+/// \brief  Returns the cost to move from a node to one of its neighbors
+///         The terrain cost of the neighbor scaled by the move length
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline PriorityType TCompactGrid<CoordinateType, PriorityType, Moves>::GetCost(const TTNode& from, const TTNode& to) const
+{
+    const PriorityType cost = m_costs.empty() ? 1 : m_costs[GetNodeIndex(to)];
+
+    if (Moves::DIAGONAL && from.X() != to.X() && from.Y() != to.Y())
+        return cost * Moves::DIAGONAL_COST;
+
+    return cost * Moves::STRAIGHT_COST;
+}
+
+/// \brief  Sets the terrain cost of a node
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+/// \param  cost The cost to enter the node, at least 1
+template <typename CoordinateType, typename PriorityType, typename Moves>
+void TCompactGrid<CoordinateType, PriorityType, Moves>::SetNodeCost(CoordinateType x, CoordinateType y, unsigned char cost)
+{
+    // A free node would break the admissibility of the heuristics
+    cost = std::max<unsigned char>(cost, 1);
+
+    // Costs are only stored once one of them isn't 1
+    if (m_costs.empty() && cost == 1)
+        return;
+
+    if (m_costs.empty())
+        m_costs.assign(GetNodeCount(), 1);
+
+    m_costs[static_cast<std::size_t>(y) * m_width + x] = cost;
+    ++m_epoch;
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline unsigned char TCompactGrid<CoordinateType, PriorityType, Moves>::GetNodeCost(CoordinateType x, CoordinateType y) const
+{ return m_costs.empty() ? 1 : m_costs[static_cast<std::size_t>(y) * m_width + x]; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline TNode<CoordinateType, PriorityType> TCompactGrid<CoordinateType, PriorityType, Moves>::GetNode(CoordinateType x, CoordinateType y) const
+{
+    TTNode node(x, y);
+    node.SetNeighborFlag(GetFlags(x, y));
+    return node;
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline TNode<CoordinateType, PriorityType> TCompactGrid<CoordinateType, PriorityType, Moves>::GetNodeAt(std::size_t index) const
+{
+    TTNode node(static_cast<CoordinateType>(index % m_width), static_cast<CoordinateType>(index / m_width));
+    node.SetNeighborFlag(GetFlags(node.X(), node.Y()));
+    return node;
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TCompactGrid<CoordinateType, PriorityType, Moves>::GetNodeIndex(const TTNode& node) const
+{ return static_cast<std::size_t>(node.Y()) * m_width + node.X(); }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TCompactGrid<CoordinateType, PriorityType, Moves>::GetNodeCount() const
+{ return static_cast<std::size_t>(m_width) * m_height; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline CoordinateType TCompactGrid<CoordinateType, PriorityType, Moves>::GetWidth() const
+{ return m_width; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline CoordinateType TCompactGrid<CoordinateType, PriorityType, Moves>::GetHeight() const
+{ return m_height; }
+
+/// \brief  Sets the neighbors of a node,
+///         drops the component labels if a straight edge changed
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+/// \param  flag The flag to apply
+template <typename CoordinateType, typename PriorityType, typename Moves>
+void TCompactGrid<CoordinateType, PriorityType, Moves>::SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag)
+{
+    const std::size_t slot = GetSlot(x, y);
+
+    if (!Moves::DIAGONAL)
+        flag &= TTNode::ALL;
+
+    // Diagonal moves always have a straight detour, see TMovePolicy.hpp
+    if ((GetFlags(x, y) ^ flag) & TTNode::ALL)
+        m_components.clear();
+
+    if (NODES_PER_BYTE == 1)
+    {
+        m_flags[slot] = flag;
+    }
+    else
+    {
+        const unsigned shift = (slot % 2) * 4;
+        m_flags[slot / 2] = static_cast<unsigned char>((m_flags[slot / 2] & ~(0xF << shift)) | (flag << shift));
+    }
+
+    ++m_epoch;
+}
+
+/// \brief  Labels the connected components with a flood fill
+template <typename CoordinateType, typename PriorityType, typename Moves>
+void TCompactGrid<CoordinateType, PriorityType, Moves>::UpdateComponents()
+{
+    const std::uint32_t unlabeled = UINT32_MAX;
+
+    std::vector<std::size_t> fill;
+    std::vector<TTNode>      neighbors;
+    std::uint32_t            label = 0;
+
+    m_components.assign(GetNodeCount(), unlabeled);
+
+    for (std::size_t first = 0; first < m_components.size(); ++first)
+    {
+        if (m_components[first] != unlabeled)
+            continue;
+
+        m_components[first] = label;
+        fill.assign(1, first);
+
+        while (!fill.empty())
+        {
+            const std::size_t current = fill.back();
+            fill.pop_back();
+
+            neighbors.clear();
+            GetNeighbors(GetNodeAt(current), neighbors);
+
+            for (const TTNode& next : neighbors)
+            {
+                const std::size_t index = GetNodeIndex(next);
+                if (m_components[index] == unlabeled)
+                {
+                    m_components[index] = label;
+                    fill.push_back(index);
+                }
+            }
+        }
+
+        ++label;
+    }
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline bool TCompactGrid<CoordinateType, PriorityType, Moves>::IsReachable(const TTNode& from, const TTNode& to) const
+{ return m_components.empty() || m_components[GetNodeIndex(from)] == m_components[GetNodeIndex(to)]; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TCompactGrid<CoordinateType, PriorityType, Moves>::GetComponent(CoordinateType x, CoordinateType y) const
+{ return m_components.empty() ? 0 : m_components[static_cast<std::size_t>(y) * m_width + x]; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TCompactGrid<CoordinateType, PriorityType, Moves>::GetEpoch() const
+{ return m_epoch; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TCompactGrid<CoordinateType, PriorityType, Moves>::GetNodeEpoch(std::size_t /* index */) const
+{ return m_epoch; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline bool TCompactGrid<CoordinateType, PriorityType, Moves>::IsValidNode(CoordinateType x, CoordinateType y) const
+{ return (x >= 0 && x < m_width && y >= 0 && y < m_height); }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TCompactGrid<CoordinateType, PriorityType, Moves>::GetMemoryUsage() const
+{
+    return sizeof(*this)
+         + m_flags.capacity()
+         + m_costs.capacity()
+         + m_components.capacity() * sizeof(std::uint32_t);
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline unsigned char TCompactGrid<CoordinateType, PriorityType, Moves>::GetFlags(int x, int y) const
+{
+    const std::size_t slot = GetSlot(x, y);
+
+    if (NODES_PER_BYTE == 1)
+        return m_flags[slot];
+
+    return static_cast<unsigned char>((m_flags[slot / 2] >> ((slot % 2) * 4)) & 0xF);
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TCompactGrid<CoordinateType, PriorityType, Moves>::GetSlot(int x, int y) const
+{ return static_cast<std::size_t>(y + 1) * (static_cast<std::size_t>(m_width) + 1) + static_cast<std::size_t>(x + 1); }
+
+} // !namespace nav
@@ -0,0 +1,159 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TFirstMoveTable.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_FIRST_MOVE_TABLE_HPP
+#define PATHFINDING_T_FIRST_MOVE_TABLE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+#include "TNode.hpp"
+#include "SMoveDirection.hpp"
+#include "CWorkStealingPool.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  The version written by TFirstMoveTable::Save, bumped on layout changes
+constexpr std::uint32_t FIRST_MOVE_FILE_VERSION = 1;
+
+/// \brief  Leading block of a first move file
+///
+///         Followed by the first run of each source in row major order
+///         and the end of the last one, as 64 bits offsets, then by the
+///         runs as 32 bits values (see TFirstMoveTable).
+struct SFirstMoveFileHeader
+{
+    char          magic[4];  ///< "NAVM"
+    std::uint32_t version;   ///< FIRST_MOVE_FILE_VERSION
+    std::uint32_t width;     ///< The width of the grid
+    std::uint32_t height;    ///< The height of the grid
+    std::uint64_t run_count; ///< The number of runs
+    std::uint64_t size;      ///< The size of the file, detects truncation
+};
+
+/// \class  TFirstMoveTable
+/// \brief  Compressed table of the first move of an optimal path between
+///         any two nodes of a static grid
+///
+///         One Dijkstra search per source gives the first move toward
+///         every target. The targets are sorted in Z-order, close targets
+///         share their first move, and the moves of a source are stored
+///         as runs : the rank of the first target of the run in the top
+///         28 bits, the move in the low 4 bits. Unreachable targets may
+///         take any move, they extend the runs around them.
+///
+///         A path is followed one lookup per step, a binary search in the
+///         runs of the current node, without any search. The nodes after
+///         the first move are on an optimal path too, the path is optimal.
+///
+///         The table is read only once built and may be used from any
+///         thread. It must be built again after an edit of the grid.
+///
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+template <typename CoordinateType, typename PriorityType>
+class TFirstMoveTable
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  The move between a node and itself or an unreachable node
+    static constexpr unsigned char NO_DIRECTION = SMoveDirection::NONE;
+
+    /// \brief  Computes the first moves of all sources, in chunks of sources
+    ///         on a pool of workers
+    /// \param  graph The graph to build the table on
+    /// \param  pool The workers
+    /// \param  grain The number of sources per stolen chunk
+    template <typename Graph>
+    void Build(const Graph& graph, CWorkStealingPool& pool, std::size_t grain = 16);
+
+    /// \brief  Writes the table to a file
+    /// \param  path The path of the file
+    /// \return false if the file can't be written
+    bool Save(const char* path) const;
+
+    /// \brief  Reads a table written by Save
+    /// \param  path The path of the file
+    /// \return false if the file can't be read or isn't a valid first move file,
+    ///         the table is then empty
+    bool Load(const char* path);
+
+    /// \brief  Returns the first move of an optimal path between two nodes
+    /// \param  from The start node
+    /// \param  to The end node
+    /// \return The direction code (see SMoveDirection), any move if
+    ///         to can't be reached, NO_DIRECTION if the nodes are the same
+    inline unsigned char GetFirstMove(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Follows the first moves from a node to another
+    /// \param  graph The graph the table was built on
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return true if end is reachable
+    template <typename Graph>
+    bool GetPath(const Graph& graph, std::vector<TTNode>& path, const TTNode& start, const TTNode& end) const;
+
+    /// \brief  Returns the number of runs of all sources
+    inline std::size_t GetRunCount() const;
+
+    /// \brief  Returns the number of bytes used by the table
+    inline std::size_t GetMemoryUsage() const;
+
+    /// \brief  Tells if the table matches the size of a graph
+    template <typename Graph>
+    bool Matches(const Graph& graph) const;
+
+    /// \brief  Returns the move of a direction code
+    /// \param  direction The code (N, E, S, W, NE, SE, SW, NW)
+    /// \param  dx The X offset
+    /// \param  dy The Y offset
+    static inline void GetOffset(unsigned char direction, int& dx, int& dy);
+
+private:
+
+    /// \brief  Sorts the nodes in Z-order, sets the rank of each node
+    void ComputeRanks();
+
+    /// \brief  Runs a Dijkstra search from a source and keeps the first move
+    ///         toward each node, indexed by rank
+    template <typename Graph>
+    void Integrate(const Graph& graph, const TTNode& source, std::vector<PriorityType>& distances,
+                   std::vector<unsigned char>& moves, std::vector<unsigned char>& ranked) const;
+
+    std::size_t                m_width  = 0; ///< The width of the grid
+    std::size_t                m_height = 0; ///< The height of the grid
+    std::vector<std::uint32_t> m_ranks;      ///< The Z-order rank of each node, row major
+    std::vector<std::uint64_t> m_offsets;    ///< The first run of each source, and the end
+    std::vector<std::uint32_t> m_runs;       ///< The rank and the move of each run
+};
+
+} // !namespace nav
+
+#include "TFirstMoveTable.inl"
+
+#endif // PATHFINDING_T_FIRST_MOVE_TABLE_HPP
@@ -0,0 +1,359 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TFirstMoveTable.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <limits>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+
+#include "TFrontier.hpp"
+#include "TGridLayout.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+template <typename CoordinateType, typename PriorityType>
+constexpr unsigned char TFirstMoveTable<CoordinateType, PriorityType>::NO_DIRECTION;
+
+/// \brief  Computes the first moves of all sources, in chunks of sources
+///         on a pool of workers
+/// \param  graph The graph to build the table on
+/// \param  pool The workers
+/// \param  grain The number of sources per stolen chunk
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+void TFirstMoveTable<CoordinateType, PriorityType>::Build(const Graph& graph, CWorkStealingPool& pool, std::size_t grain)
+{
+    m_width  = static_cast<std::size_t>(graph.GetWidth());
+    m_height = static_cast<std::size_t>(graph.GetHeight());
+    ComputeRanks();
+
+    const std::size_t                       count = m_width * m_height;
+    std::vector<std::vector<std::uint32_t>> runs(count);
+
+    // Each worker writes the runs of its own sources only
+    pool.ParallelFor(count, grain, [&](std::size_t /* worker */, std::size_t begin, std::size_t end)
+    {
+        std::vector<PriorityType>  distances;
+        std::vector<unsigned char> moves;
+        std::vector<unsigned char> ranked;
+
+        for (std::size_t source = begin; source < end; ++source)
+        {
+            const TTNode node = graph.GetNode(static_cast<CoordinateType>(source % m_width), static_cast<CoordinateType>(source / m_width));
+            Integrate(graph, node, distances, moves, ranked);
+
+            // The first run starts at rank 0, the unreachable targets before it take its move
+            std::vector<std::uint32_t>& source_runs = runs[source];
+            unsigned char               current     = NO_DIRECTION;
+            for (std::size_t rank = 0; rank < count; ++rank)
+            {
+                const unsigned char move = ranked[rank];
+                if (move == NO_DIRECTION || move == current)
+                    continue;
+
+                source_runs.push_back(static_cast<std::uint32_t>(source_runs.empty() ? 0 : rank) << 4 | move);
+                current = move;
+            }
+
+            source_runs.shrink_to_fit();
+        }
+    });
+
+    m_offsets.assign(count + 1, 0);
+    for (std::size_t source = 0; source < count; ++source)
+        m_offsets[source + 1] = m_offsets[source] + runs[source].size();
+
+    m_runs.resize(static_cast<std::size_t>(m_offsets.back()));
+    for (std::size_t source = 0; source < count; ++source)
+    {
+        std::copy(runs[source].begin(), runs[source].end(), m_runs.begin() + m_offsets[source]);
+        std::vector<std::uint32_t>().swap(runs[source]);
+    }
+}
+
+/// \brief  Writes the table to a file
+/// \param  path The path of the file
+/// \return false if the file can't be written
+template <typename CoordinateType, typename PriorityType>
+bool TFirstMoveTable<CoordinateType, PriorityType>::Save(const char* path) const
+{
+    SFirstMoveFileHeader header;
+    std::memcpy(header.magic, "NAVM", 4);
+    header.version   = FIRST_MOVE_FILE_VERSION;
+    header.width     = static_cast<std::uint32_t>(m_width);
+    header.height    = static_cast<std::uint32_t>(m_height);
+    header.run_count = m_runs.size();
+    header.size      = sizeof(header) + m_offsets.size() * sizeof(std::uint64_t) + m_runs.size() * sizeof(std::uint32_t);
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && std::fwrite(m_offsets.data(), sizeof(std::uint64_t), m_offsets.size(), file) == m_offsets.size();
+    ok = ok && std::fwrite(m_runs.data(),    sizeof(std::uint32_t), m_runs.size(),    file) == m_runs.size();
+
+    return std::fclose(file) == 0 && ok;
+}
+
+/// \brief  Reads a table written by Save
+/// \param  path The path of the file
+/// \return false if the file can't be read or isn't a valid first move file,
+///         the table is then empty
+template <typename CoordinateType, typename PriorityType>
+bool TFirstMoveTable<CoordinateType, PriorityType>::Load(const char* path)
+{
+    m_width  = 0;
+    m_height = 0;
+    m_ranks.clear();
+    m_offsets.clear();
+    m_runs.clear();
+
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+        return false;
+
+    SFirstMoveFileHeader header;
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+           && std::memcmp(header.magic, "NAVM", 4) == 0
+           && header.version == FIRST_MOVE_FILE_VERSION
+           && header.width   <= static_cast<std::uint64_t>(std::numeric_limits<CoordinateType>::max())
+           && header.height  <= static_cast<std::uint64_t>(std::numeric_limits<CoordinateType>::max());
+
+    const std::uint64_t node_count = ok ? static_cast<std::uint64_t>(header.width) * header.height : 0;
+    const std::uint64_t run_count  = ok ? header.run_count : 0;
+
+    ok = ok && header.size == sizeof(header) + (node_count + 1) * sizeof(std::uint64_t) + run_count * sizeof(std::uint32_t);
+
+    if (ok)
+    {
+        m_offsets.resize(static_cast<std::size_t>(node_count + 1));
+        m_runs.resize(static_cast<std::size_t>(run_count));
+
+        ok = std::fread(m_offsets.data(), sizeof(std::uint64_t), m_offsets.size(), file) == m_offsets.size()
+          && std::fread(m_runs.data(),    sizeof(std::uint32_t), m_runs.size(),    file) == m_runs.size();
+    }
+
+    std::fclose(file);
+
+    // The runs of a source must be sorted, on the grid and hold a move
+    ok = ok && m_offsets.front() == 0 && m_offsets.back() == run_count;
+    for (std::size_t source = 0; ok && source < node_count; ++source)
+    {
+        ok = m_offsets[source] <= m_offsets[source + 1] && m_offsets[source + 1] <= run_count;
+        for (std::uint64_t run = m_offsets[source]; ok && run < m_offsets[source + 1]; ++run)
+        {
+            ok = (m_runs[run] >> 4) < node_count && (m_runs[run] & 0xF) < 8
+              && (run == m_offsets[source] ? (m_runs[run] >> 4) == 0 : m_runs[run - 1] < m_runs[run]);
+        }
+    }
+
+    if (!ok)
+    {
+        m_offsets.clear();
+        m_runs.clear();
+        return false;
+    }
+
+    m_width  = header.width;
+    m_height = header.height;
+    ComputeRanks();
+    return true;
+}
+
+/// \brief  Returns the first move of an optimal path between two nodes
+/// \param  from The start node
+/// \param  to The end node
+/// \return The direction code (see SMoveDirection), any move if
+///         to can't be reached, NO_DIRECTION if the nodes are the same
+template <typename CoordinateType, typename PriorityType>
+inline unsigned char TFirstMoveTable<CoordinateType, PriorityType>::GetFirstMove(const TTNode& from, const TTNode& to) const
+{
+    const std::size_t source = static_cast<std::size_t>(from.Y()) * m_width + from.X();
+    const std::size_t target = static_cast<std::size_t>(to.Y())   * m_width + to.X();
+
+    const std::uint32_t* first = m_runs.data() + m_offsets[source];
+    const std::uint32_t* last  = m_runs.data() + m_offsets[source + 1];
+    if (source == target || first == last)
+        return NO_DIRECTION;
+
+    // The last run starting at or before the target, the first one starts at 0
+    const std::uint32_t* run = std::upper_bound(first, last, m_ranks[target] << 4 | 0xF);
+    return static_cast<unsigned char>(run[-1] & 0xF);
+}
+
+/// \brief  Follows the first moves from a node to another
+/// \param  graph The graph the table was built on
+/// \param  path The vector to store the result (in reverse order)
+/// \param  start The start node
+/// \param  end The end node
+/// \return true if end is reachable
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+bool TFirstMoveTable<CoordinateType, PriorityType>::GetPath(const Graph& graph, std::vector<TTNode>& path, const TTNode& start, const TTNode& end) const
+{
+    // The moves toward unreachable nodes are arbitrary
+    if (!graph.IsReachable(start, end))
+        return false;
+
+    const std::size_t first = path.size();
+
+    TTNode current(start);
+    path.push_back(current);
+
+    while (current.X() != end.X() || current.Y() != end.Y())
+    {
+        const unsigned char direction = GetFirstMove(current, end);
+
+        // Isolated node, or a table of another grid looping
+        if (direction == NO_DIRECTION || path.size() - first > m_width * m_height)
+        {
+            path.resize(first);
+            return false;
+        }
+
+        int dx, dy;
+        GetOffset(direction, dx, dy);
+
+        current = graph.GetNode(static_cast<CoordinateType>(current.X() + dx), static_cast<CoordinateType>(current.Y() + dy));
+        path.push_back(current);
+    }
+
+    std::reverse(path.begin() + first, path.end());
+    return true;
+}
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t TFirstMoveTable<CoordinateType, PriorityType>::GetRunCount() const
+{ return m_runs.size(); }
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t TFirstMoveTable<CoordinateType, PriorityType>::GetMemoryUsage() const
+{ return m_ranks.size() * sizeof(std::uint32_t) + m_offsets.size() * sizeof(std::uint64_t) + m_runs.size() * sizeof(std::uint32_t); }
+
+/// \brief  Tells if the table matches the size of a graph
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+bool TFirstMoveTable<CoordinateType, PriorityType>::Matches(const Graph& graph) const
+{
+    return m_width  == static_cast<std::size_t>(graph.GetWidth())
+        && m_height == static_cast<std::size_t>(graph.GetHeight())
+        && !m_offsets.empty();
+}
+
+/// \brief  Returns the move of a direction code
+/// \param  direction The code (N, E, S, W, NE, SE, SW, NW)
+/// \param  dx The X offset
+/// \param  dy The Y offset
+template <typename CoordinateType, typename PriorityType>
+inline void TFirstMoveTable<CoordinateType, PriorityType>::GetOffset(unsigned char direction, int& dx, int& dy)
+{
+    SMoveDirection::GetOffset(direction, dx, dy);
+}
+
+/// \brief  Sorts the nodes in Z-order, sets the rank of each node
+template <typename CoordinateType, typename PriorityType>
+void TFirstMoveTable<CoordinateType, PriorityType>::ComputeRanks()
+{
+    // One block covers any grid, the curve isn't cut
+    TMortonLayout<16> layout;
+    layout.Initialize(m_width, m_height);
+
+    std::vector<std::pair<std::size_t, std::uint32_t>> keys;
+    keys.reserve(m_width * m_height);
+    for (std::size_t y = 0; y < m_height; ++y)
+    {
+        for (std::size_t x = 0; x < m_width; ++x)
+            keys.emplace_back(layout.GetIndex(x, y), static_cast<std::uint32_t>(y * m_width + x));
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    m_ranks.resize(keys.size());
+    for (std::size_t rank = 0; rank < keys.size(); ++rank)
+        m_ranks[keys[rank].second] = static_cast<std::uint32_t>(rank);
+}
+
+/// \brief  Runs a Dijkstra search from a source and keeps the first move
+///         toward each node, indexed by rank
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+void TFirstMoveTable<CoordinateType, PriorityType>::Integrate(const Graph& graph, const TTNode& source, std::vector<PriorityType>& distances,
+                                                              std::vector<unsigned char>& moves, std::vector<unsigned char>& ranked) const
+{
+    TDefaultFrontier<CoordinateType, PriorityType> frontier;
+    std::vector<TTNode>                            neighbors;
+
+    const std::size_t source_index = graph.GetNodeIndex(source);
+    distances.assign(graph.GetNodeCount(), std::numeric_limits<PriorityType>::max());
+    moves    .assign(graph.GetNodeCount(), NO_DIRECTION);
+
+    TTNode start(source);
+    start.SetPriority(0);
+    frontier.Push(start);
+    distances[source_index] = 0;
+
+    while (!frontier.IsEmpty())
+    {
+        const TTNode      current(frontier.Pop());
+        const std::size_t current_index = graph.GetNodeIndex(current);
+
+        // Pushed again with a better distance since this entry was queued
+        if (current.GetPriority() > distances[current_index])
+            continue;
+
+        neighbors.clear();
+        graph.GetNeighbors(current, neighbors);
+
+        for (TTNode& next : neighbors)
+        {
+            const std::size_t  next_index = graph.GetNodeIndex(next);
+            const PriorityType distance   = distances[current_index] + graph.GetCost(current, next);
+
+            if (distance < distances[next_index])
+            {
+                // The neighbors of the source start the moves, the others inherit them
+                distances[next_index] = distance;
+                moves    [next_index] = current_index == source_index ? SMoveDirection::GetDirection(next.X() - current.X(), next.Y() - current.Y())
+                                                                      : moves[current_index];
+
+                next.SetPriority(distance);
+                frontier.Push(next);
+            }
+        }
+    }
+
+    ranked.assign(m_width * m_height, NO_DIRECTION);
+    for (std::size_t y = 0; y < m_height; ++y)
+    {
+        for (std::size_t x = 0; x < m_width; ++x)
+        {
+            const TTNode node = graph.GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y));
+            ranked[m_ranks[y * m_width + x]] = moves[graph.GetNodeIndex(node)];
+        }
+    }
+}
+
+} // !namespace nav
@@ -0,0 +1,139 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TFlowField.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_FLOW_FIELD_HPP
+#define PATHFINDING_T_FLOW_FIELD_HPP
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+#include "TNode.hpp"
+#include "TFrontier.hpp"
+#include "SMoveDirection.hpp"
+#include "CWorkStealingPool.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TFlowField
+/// \brief  Shortest directions from every node of a grid to one goal
+///
+///         The integration field holds the cost from each node to the goal,
+///         it is computed by a single Dijkstra search started at the goal.
+///         Each node then points to the neighbor that leads to the goal
+///         at the lowest cost. This pass only reads the integration field,
+///         it can be split by rows over a pool of workers.
+///
+///         A field is read only once built : any number of agents may
+///         follow it, from any thread. It keeps the grid epoch it was built
+///         at, a field built before an edit must be built again.
+///
+/// \tparam Graph The grid class
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+/// \tparam FrontierPolicy The open list of the integration (see TFrontier.hpp)
+template <typename Graph, typename CoordinateType, typename PriorityType,
+          typename FrontierPolicy = TDefaultFrontier<CoordinateType, PriorityType>>
+class TFlowField
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  The direction of the goal node and of unreachable nodes
+    static constexpr unsigned char NO_DIRECTION = 0xFF;
+
+    /// \brief  The cost of unreachable nodes
+    static constexpr PriorityType UNREACHABLE = std::numeric_limits<PriorityType>::max();
+
+    /// \brief  Builds the field of a goal
+    /// \param  graph The graph to build the field on
+    /// \param  goal The node all directions lead to
+    void Build(const Graph& graph, const TTNode& goal);
+
+    /// \brief  Builds the field of a goal, the directions are
+    ///         computed by row chunks on a pool of workers
+    /// \param  graph The graph to build the field on
+    /// \param  goal The node all directions lead to
+    /// \param  pool The workers
+    /// \param  grain The number of rows per stolen chunk
+    void Build(const Graph& graph, const TTNode& goal, CWorkStealingPool& pool, std::size_t grain = 16);
+
+    /// \brief  Returns the node to move to from a node
+    /// \param  graph The graph the field was built on
+    /// \param  from The current node of the agent
+    /// \param  next The node to move to
+    /// \return false if from is the goal or can't reach it
+    inline bool GetNextNode(const Graph& graph, const TTNode& from, TTNode& next) const;
+
+    /// \brief  Follows the field from a node to the goal
+    /// \param  graph The graph the field was built on
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \return true if the goal is reachable
+    bool GetPath(const Graph& graph, std::vector<TTNode>& path, const TTNode& start) const;
+
+    /// \brief  Returns the direction code of a node (see GetOffset)
+    /// \param  index The index of the node (see Graph::GetNodeIndex)
+    inline unsigned char GetDirection(std::size_t index) const;
+
+    /// \brief  Returns the cost from a node to the goal
+    /// \param  index The index of the node (see Graph::GetNodeIndex)
+    /// \return UNREACHABLE if there is no path
+    inline PriorityType GetCost(std::size_t index) const;
+
+    /// \brief  Returns the index of the goal node
+    inline std::size_t GetGoalIndex() const;
+
+    /// \brief  Tells if the graph was not edited since the field was built
+    inline bool IsValid(const Graph& graph) const;
+
+    /// \brief  Returns the move of a direction code
+    /// \param  direction The code (N, E, S, W, NE, SE, SW, NW)
+    /// \param  dx The X offset
+    /// \param  dy The Y offset
+    static inline void GetOffset(unsigned char direction, int& dx, int& dy);
+
+private:
+
+    /// \brief  Computes the cost to the goal of all nodes
+    void Integrate(const Graph& graph, const TTNode& goal);
+
+    /// \brief  Computes the direction of the nodes of a range of rows
+    void ComputeDirections(const Graph& graph, std::size_t firstRow, std::size_t lastRow);
+
+    std::vector<PriorityType>  m_costs;          ///< The integration field
+    std::vector<unsigned char> m_directions;     ///< The direction field
+    std::size_t                m_goal_index = 0; ///< The index of the goal
+    std::uint32_t              m_epoch      = 0; ///< The grid epoch of the build
+    FrontierPolicy             m_frontier;       ///< The open list of the integration
+    std::vector<TTNode>        m_neighbors;      ///< The neighbors of the expanded node
+};
+
+} // !namespace nav
+
+#include "TFlowField.inl"
+
+#endif // PATHFINDING_T_FLOW_FIELD_HPP
@@ -0,0 +1,226 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TFlowField.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <algorithm>
+
+/// \namespace nav
+namespace nav
+{
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+constexpr unsigned char TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::NO_DIRECTION;
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+constexpr PriorityType TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::UNREACHABLE;
+
+/// \brief  Builds the field of a goal
+/// \param  graph The graph to build the field on
+/// \param  goal The node all directions lead to
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+void TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::Build(const Graph& graph, const TTNode& goal)
+{
+    Integrate(graph, goal);
+    ComputeDirections(graph, 0, static_cast<std::size_t>(graph.GetHeight()));
+}
+
+/// \brief  Builds the field of a goal, the directions are
+///         computed by row chunks on a pool of workers
+/// \param  graph The graph to build the field on
+/// \param  goal The node all directions lead to
+/// \param  pool The workers
+/// \param  grain The number of rows per stolen chunk
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+void TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::Build(const Graph& graph, const TTNode& goal, CWorkStealingPool& pool, std::size_t grain)
+{
+    Integrate(graph, goal);
+
+    // Each row only reads the integration field and writes its own directions
+    pool.ParallelFor(static_cast<std::size_t>(graph.GetHeight()), grain, [&](std::size_t /* worker */, std::size_t begin, std::size_t end)
+    {
+        ComputeDirections(graph, begin, end);
+    });
+}
+
+/// \brief  Returns the node to move to from a node
+/// \param  graph The graph the field was built on
+/// \param  from The current node of the agent
+/// \param  next The node to move to
+/// \return false if from is the goal or can't reach it
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+inline bool TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::GetNextNode(const Graph& graph, const TTNode& from, TTNode& next) const
+{
+    const unsigned char direction = m_directions[graph.GetNodeIndex(from)];
+    if (direction == NO_DIRECTION)
+        return false;
+
+    int dx, dy;
+    GetOffset(direction, dx, dy);
+
+    next = graph.GetNode(static_cast<CoordinateType>(from.X() + dx), static_cast<CoordinateType>(from.Y() + dy));
+    return true;
+}
+
+/// \brief  Follows the field from a node to the goal
+/// \param  graph The graph the field was built on
+/// \param  path The vector to store the result (in reverse order)
+/// \param  start The start node
+/// \return true if the goal is reachable
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+bool TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::GetPath(const Graph& graph, std::vector<TTNode>& path, const TTNode& start) const
+{
+    if (m_costs[graph.GetNodeIndex(start)] == UNREACHABLE)
+        return false;
+
+    const std::size_t first = path.size();
+
+    TTNode current(start);
+    path.push_back(current);
+
+    while (GetNextNode(graph, current, current))
+        path.push_back(current);
+
+    std::reverse(path.begin() + first, path.end());
+    return true;
+}
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+inline unsigned char TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::GetDirection(std::size_t index) const
+{ return m_directions[index]; }
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+inline PriorityType TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::GetCost(std::size_t index) const
+{ return m_costs[index]; }
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+inline std::size_t TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::GetGoalIndex() const
+{ return m_goal_index; }
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+inline bool TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::IsValid(const Graph& graph) const
+{ return !m_costs.empty() && graph.GetEpoch() == m_epoch; }
+
+/// \brief  Returns the move of a direction code
+/// \param  direction The code (N, E, S, W, NE, SE, SW, NW)
+/// \param  dx The X offset
+/// \param  dy The Y offset
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+inline void TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::GetOffset(unsigned char direction, int& dx, int& dy)
+{
+    SMoveDirection::GetOffset(direction, dx, dy);
+}
+
+/// \brief  Computes the cost to the goal of all nodes
+///         Moves are symmetric, the search runs from the goal and
+///         charges the cost of the move toward the expanded node
+/// \param  graph The graph to build the field on
+/// \param  goal The node all directions lead to
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+void TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::Integrate(const Graph& graph, const TTNode& goal)
+{
+    m_costs.assign(graph.GetNodeCount(), UNREACHABLE);
+    m_directions.assign(graph.GetNodeCount(), NO_DIRECTION);
+    m_goal_index = graph.GetNodeIndex(goal);
+    m_epoch      = graph.GetEpoch();
+
+    TTNode start(goal);
+    start.SetPriority(0);
+
+    m_frontier.Clear();
+    m_frontier.Push(start);
+    m_costs[m_goal_index] = 0;
+
+    while (!m_frontier.IsEmpty())
+    {
+        const TTNode      current(m_frontier.Pop());
+        const std::size_t current_index = graph.GetNodeIndex(current);
+
+        // Pushed again with a better cost since this entry was queued
+        if (current.GetPriority() > m_costs[current_index])
+            continue;
+
+        m_neighbors.clear();
+        graph.GetNeighbors(current, m_neighbors);
+
+        for (TTNode& next : m_neighbors)
+        {
+            const std::size_t  next_index = graph.GetNodeIndex(next);
+            const PriorityType new_cost   = m_costs[current_index] + graph.GetCost(next, current);
+
+            if (new_cost < m_costs[next_index])
+            {
+                m_costs[next_index] = new_cost;
+
+                next.SetPriority(new_cost);
+                m_frontier.Push(next);
+            }
+        }
+    }
+}
+
+/// \brief  Computes the direction of the nodes of a range of rows
+///         Each node points to the neighbor minimizing the move cost
+///         plus the cost of the neighbor to the goal
+/// \param  graph The graph to build the field on
+/// \param  firstRow The first row
+/// \param  lastRow The row after the last one
+template <typename Graph, typename CoordinateType, typename PriorityType, typename FrontierPolicy>
+void TFlowField<Graph, CoordinateType, PriorityType, FrontierPolicy>::ComputeDirections(const Graph& graph, std::size_t firstRow, std::size_t lastRow)
+{
+    std::vector<TTNode> neighbors;
+    neighbors.reserve(8);
+
+    for (std::size_t y = firstRow; y < lastRow; ++y)
+    {
+        for (CoordinateType x = 0; x < graph.GetWidth(); ++x)
+        {
+            const TTNode      node  = graph.GetNode(x, static_cast<CoordinateType>(y));
+            const std::size_t index = graph.GetNodeIndex(node);
+
+            if (index == m_goal_index || m_costs[index] == UNREACHABLE)
+                continue;
+
+            neighbors.clear();
+            graph.GetNeighbors(node, neighbors);
+
+            PriorityType  best_cost = UNREACHABLE;
+            unsigned char direction = NO_DIRECTION;
+
+            for (const TTNode& next : neighbors)
+            {
+                const PriorityType next_cost = m_costs[graph.GetNodeIndex(next)];
+                if (next_cost == UNREACHABLE)
+                    continue;
+
+                const PriorityType cost = next_cost + graph.GetCost(node, next);
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    direction = SMoveDirection::GetDirection(next.X() - node.X(), next.Y() - node.Y());
+                }
+            }
+
+            m_directions[index] = direction;
+        }
+    }
+}
+
+} // !namespace nav
@@ -0,0 +1,204 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TFrontier.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_FRONTIER_HPP
+#define PATHFINDING_T_FRONTIER_HPP
+
+#include <memory>
+#include <vector>
+#include <cstdlib>     ///< std::size_t
+#include <algorithm>
+#include <type_traits>
+
+#include "TNode.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TBinaryHeapFrontier
+/// \brief  Open list stored as a binary heap, works with any priority type
+/// \tparam CoordinateType The type of the coordinates
+/// \tparam PriorityType   The type of the priority
+/// \tparam Allocator      The allocator of the nodes
+template <typename CoordinateType, typename PriorityType,
+          typename Allocator = std::allocator<TNode<CoordinateType, PriorityType>>>
+class TBinaryHeapFrontier
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  Creates an empty open list
+    /// \param  allocator The allocator of the nodes
+    explicit TBinaryHeapFrontier(const Allocator& allocator = Allocator())
+    : m_heap(allocator)
+    { /* None */ }
+
+    /// \brief  Removes all nodes, the storage is kept
+    /* inline */ void Clear()
+    { m_heap.clear(); }
+
+    /// \brief  Tells if there is no node left
+    /// \return True or false
+    /* inline */ bool IsEmpty() const
+    { return m_heap.empty(); }
+
+    /// \brief  Adds a node with its priority
+    /// \param  node The node to add
+    /* inline */ void Push(const TTNode& node)
+    {
+        // TNode::operator< is reversed, the heap gives the lowest priority
+        m_heap.push_back(node);
+        std::push_heap(m_heap.begin(), m_heap.end());
+    }
+
+    /// \brief  Removes the node with the lowest priority
+    /// \return The removed node
+    /* inline */ TTNode Pop()
+    {
+        std::pop_heap(m_heap.begin(), m_heap.end());
+        TTNode node(m_heap.back());
+        m_heap.pop_back();
+
+        return node;
+    }
+
+private:
+
+    std::vector<TTNode, Allocator> m_heap; ///< The heap
+};
+
+/// \class  TBucketFrontier
+/// \brief  Open list with one bucket per priority (Dial's algorithm)
+///
+///         Push and pop are O(1). With a consistent heuristic the
+///         priorities popped never decrease, the cursor only moves forward
+///         and the buckets span the detour of the path only. Lower
+///         priorities are still accepted, the cursor just moves back.
+///         Nodes of the same priority are popped last in first out.
+///
+/// \tparam CoordinateType The type of the coordinates
+/// \tparam PriorityType   The type of the priority, must be an integer
+/// \tparam Allocator      The allocator of the nodes, the buckets use it too
+template <typename CoordinateType, typename PriorityType,
+          typename Allocator = std::allocator<TNode<CoordinateType, PriorityType>>>
+class TBucketFrontier
+{
+public:
+
+    static_assert(std::is_integral<PriorityType>::value, "TBucketFrontier needs integer priorities");
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  Creates an empty open list
+    /// \param  allocator The allocator of the nodes
+    explicit TBucketFrontier(const Allocator& allocator = Allocator())
+    : m_buckets(TTBucketAllocator(allocator))
+    { /* None */ }
+
+    /// \brief  Removes all nodes, the buckets keep their storage
+    /* inline */ void Clear()
+    {
+        // Buckets below the cursor are always empty
+        for (std::size_t bucket = m_cursor; bucket < m_top; ++bucket)
+            m_buckets[bucket].clear();
+
+        m_cursor = 0;
+        m_top    = 0;
+        m_size   = 0;
+    }
+
+    /// \brief  Tells if there is no node left
+    /// \return True or false
+    /* inline */ bool IsEmpty() const
+    { return m_size == 0; }
+
+    /// \brief  Adds a node with its priority
+    /// \param  node The node to add
+    /* inline */ void Push(const TTNode& node)
+    {
+        const PriorityType priority = node.GetPriority();
+
+        if (m_size == 0 && m_top == 0)
+        {
+            // First node of the query, the buckets start at its priority
+            m_base = priority;
+        }
+        else if (priority < m_base)
+        {
+            // Shifts everything up, not expected with consistent heuristics
+            const std::size_t shift = static_cast<std::size_t>(m_base - priority);
+            m_buckets.insert(m_buckets.begin(), shift, TTBucket(m_buckets.get_allocator()));
+            m_cursor += shift;
+            m_top    += shift;
+            m_base    = priority;
+        }
+
+        const std::size_t bucket = static_cast<std::size_t>(priority - m_base);
+        if (bucket >= m_buckets.size())
+            m_buckets.resize(bucket + 1, TTBucket(m_buckets.get_allocator()));
+
+        m_buckets[bucket].push_back(node);
+
+        m_cursor = std::min(m_cursor, bucket);
+        m_top    = std::max(m_top, bucket + 1);
+        ++m_size;
+    }
+
+    /// \brief  Removes the node with the lowest priority
+    /// \return The removed node
+    /* inline */ TTNode Pop()
+    {
+        while (m_buckets[m_cursor].empty())
+            ++m_cursor;
+
+        TTBucket& bucket = m_buckets[m_cursor];
+        TTNode node(bucket.back());
+        bucket.pop_back();
+        --m_size;
+
+        return node;
+    }
+
+private:
+
+    using TTBucket          = std::vector<TTNode, Allocator>;
+    using TTBucketAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<TTBucket>;
+
+    std::vector<TTBucket, TTBucketAllocator> m_buckets;    ///< One bucket per priority from m_base
+    PriorityType                             m_base   = 0; ///< The priority of the first bucket
+    std::size_t                              m_cursor = 0; ///< The lowest bucket that may hold nodes
+    std::size_t                              m_top    = 0; ///< One past the highest bucket used
+    std::size_t                              m_size   = 0; ///< The number of queued nodes
+};
+
+/// \brief  Buckets for integer priorities, binary heap otherwise
+template <typename CoordinateType, typename PriorityType,
+          typename Allocator = std::allocator<TNode<CoordinateType, PriorityType>>>
+using TDefaultFrontier = typename std::conditional<std::is_integral<PriorityType>::value,
+                                                   TBucketFrontier    <CoordinateType, PriorityType, Allocator>,
+                                                   TBinaryHeapFrontier<CoordinateType, PriorityType, Allocator>>::type;
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_FRONTIER_HPP
@@ -0,0 +1,199 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TGridLayout.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_GRID_LAYOUT_HPP
+#define PATHFINDING_T_GRID_LAYOUT_HPP
+
+#include <cstdint>
+#include <cstdlib> ///< std::size_t
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TRowMajorLayout
+/// \brief  Stores the nodes row after row (y * width + x)
+///         A north or south neighbor is a whole row away
+class TRowMajorLayout
+{
+public:
+
+    /// \brief  Sets the size of the grid
+    /// \param  width The width of the grid
+    /// \param  height The height of the grid
+    /* inline */ void Initialize(std::size_t width, std::size_t height)
+    {
+        m_width  = width;
+        m_height = height;
+    }
+
+    /// \brief  Returns the storage index of a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \return The index of the node
+    /* inline */ std::size_t GetIndex(std::size_t x, std::size_t y) const
+    { return y * m_width + x; }
+
+    /// \brief  Returns the number of stored nodes, padding included
+    /* inline */ std::size_t GetSize() const
+    { return m_width * m_height; }
+
+    /// \brief  Returns the width of the stored area, padding included
+    /* inline */ std::size_t GetPaddedWidth() const
+    { return m_width; }
+
+    /// \brief  Returns the height of the stored area, padding included
+    /* inline */ std::size_t GetPaddedHeight() const
+    { return m_height; }
+
+private:
+
+    std::size_t m_width  = 0; ///< The width of the grid
+    std::size_t m_height = 0; ///< The height of the grid
+};
+
+/// \class  TTiledLayout
+/// \brief  Stores the nodes in square tiles, row after row in each tile
+///         The tiles themselves are stored row after row
+///
+///         The grid is padded to a whole number of tiles.
+///
+/// \tparam TileBits The tiles are 2^TileBits nodes wide
+template <unsigned TileBits = 3>
+class TTiledLayout
+{
+public:
+
+    static_assert(TileBits > 0 && TileBits < 16, "TTiledLayout tiles must be 2 to 32768 nodes wide");
+
+    /// \brief  Sets the size of the grid
+    /// \param  width The width of the grid
+    /// \param  height The height of the grid
+    /* inline */ void Initialize(std::size_t width, std::size_t height)
+    {
+        m_tiles_x = (width  + MASK) >> TileBits;
+        m_tiles_y = (height + MASK) >> TileBits;
+    }
+
+    /// \brief  Returns the storage index of a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \return The index of the node
+    /* inline */ std::size_t GetIndex(std::size_t x, std::size_t y) const
+    {
+        const std::size_t tile = (y >> TileBits) * m_tiles_x + (x >> TileBits);
+        return (tile << (2 * TileBits)) | ((y & MASK) << TileBits) | (x & MASK);
+    }
+
+    /// \brief  Returns the number of stored nodes, padding included
+    /* inline */ std::size_t GetSize() const
+    { return (m_tiles_x * m_tiles_y) << (2 * TileBits); }
+
+    /// \brief  Returns the width of the stored area, padding included
+    /* inline */ std::size_t GetPaddedWidth() const
+    { return m_tiles_x << TileBits; }
+
+    /// \brief  Returns the height of the stored area, padding included
+    /* inline */ std::size_t GetPaddedHeight() const
+    { return m_tiles_y << TileBits; }
+
+private:
+
+    static constexpr std::size_t MASK = (std::size_t(1) << TileBits) - 1; ///< Coordinates in a tile
+
+    std::size_t m_tiles_x = 0; ///< The number of tiles on X
+    std::size_t m_tiles_y = 0; ///< The number of tiles on Y
+};
+
+/// \class  TMortonLayout
+/// \brief  Stores the nodes in Z-order (Morton order)
+///
+///         The bits of x and y are interleaved, so the four neighbors
+///         of a node are usually a few nodes away whatever the width.
+///         Plain Morton order pads the grid to a power of two square,
+///         which is wasteful for long maps : the curve is used inside
+///         square blocks instead, stored row after row.
+///
+/// \tparam BlockBits The blocks are 2^BlockBits nodes wide
+template <unsigned BlockBits = 6>
+class TMortonLayout
+{
+public:
+
+    static_assert(BlockBits > 0 && BlockBits <= 16, "TMortonLayout blocks must be 2 to 65536 nodes wide");
+
+    /// \brief  Sets the size of the grid
+    /// \param  width The width of the grid
+    /// \param  height The height of the grid
+    /* inline */ void Initialize(std::size_t width, std::size_t height)
+    {
+        m_blocks_x = (width  + MASK) >> BlockBits;
+        m_blocks_y = (height + MASK) >> BlockBits;
+    }
+
+    /// \brief  Returns the storage index of a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \return The index of the node
+    /* inline */ std::size_t GetIndex(std::size_t x, std::size_t y) const
+    {
+        const std::size_t block = (y >> BlockBits) * m_blocks_x + (x >> BlockBits);
+        return (block << (2 * BlockBits)) | Spread(x & MASK) | (Spread(y & MASK) << 1);
+    }
+
+    /// \brief  Returns the number of stored nodes, padding included
+    /* inline */ std::size_t GetSize() const
+    { return (m_blocks_x * m_blocks_y) << (2 * BlockBits); }
+
+    /// \brief  Returns the width of the stored area, padding included
+    /* inline */ std::size_t GetPaddedWidth() const
+    { return m_blocks_x << BlockBits; }
+
+    /// \brief  Returns the height of the stored area, padding included
+    /* inline */ std::size_t GetPaddedHeight() const
+    { return m_blocks_y << BlockBits; }
+
+private:
+
+    static constexpr std::size_t MASK = (std::size_t(1) << BlockBits) - 1; ///< Coordinates in a block
+
+    /// \brief  Inserts a zero bit between each bit of a 16 bits value
+    static /* inline */ std::size_t Spread(std::size_t value)
+    {
+        std::uint32_t bits = static_cast<std::uint32_t>(value);
+        bits = (bits | (bits << 8)) & 0x00FF00FFu;
+        bits = (bits | (bits << 4)) & 0x0F0F0F0Fu;
+        bits = (bits | (bits << 2)) & 0x33333333u;
+        bits = (bits | (bits << 1)) & 0x55555555u;
+        return bits;
+    }
+
+    std::size_t m_blocks_x = 0; ///< The number of blocks on X
+    std::size_t m_blocks_y = 0; ///< The number of blocks on Y
+};
+
+template <unsigned TileBits>  constexpr std::size_t TTiledLayout<TileBits>::MASK;
+template <unsigned BlockBits> constexpr std::size_t TMortonLayout<BlockBits>::MASK;
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_GRID_LAYOUT_HPP
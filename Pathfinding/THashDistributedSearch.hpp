@@ -0,0 +1,466 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       THashDistributedSearch.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_HASH_DISTRIBUTED_SEARCH_HPP
+#define PATHFINDING_T_HASH_DISTRIBUTED_SEARCH_HPP
+
+#include <limits>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+
+#include "TNode.hpp"
+#include "THeuristic.hpp"
+#include "TFrontier.hpp"
+#include "TSpscQueue.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  THashDistributedSearch
+/// \brief  A* of a single query spread over threads (HDA*)
+///
+///         Each node is owned by the thread picked by the hash of its block
+///         coordinates. A thread keeps the open list of its own nodes and
+///         is the only one to write their search entries. The neighbors of
+///         an expanded node owned by another thread are sent to it through
+///         a lock free queue, one queue per pair of threads.
+///
+///         The first path found is not the shortest one : it becomes the
+///         incumbent, nodes that can't improve it are dropped and the
+///         search ends when every thread is out of nodes while no message
+///         is in flight. With a consistent heuristic, the path is optimal.
+///
+///         Termination : a thread counts its sent and received messages.
+///         An idle thread checks that all threads are idle, that the sums
+///         of sent and received messages are equal, and that no thread
+///         woke up in the meantime (see DetectTermination).
+///
+///         Blocks of 2^BlockBits nodes in both dimensions keep neighbors on
+///         the same thread, fewer nodes are sent. BlockBits = 0 hashes each
+///         node as the original algorithm does.
+///
+///         Threads are started for each query, it pays off on long queries only.
+///
+/// \tparam Graph The graph class
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+/// \tparam HeuristicPolicy The heuristic, must be consistent and match the moves of the graph (see THeuristic.hpp)
+/// \tparam FrontierPolicy The open list of each thread (see TFrontier.hpp)
+/// \tparam BlockBits The log2 of the size of the hashed blocks
+template<typename Graph, typename CoordinateType, typename PriorityType,
+         typename HeuristicPolicy = TManhattanHeuristic<CoordinateType, PriorityType>,
+         typename FrontierPolicy  = TDefaultFrontier<CoordinateType, PriorityType>,
+         unsigned BlockBits       = 2>
+class THashDistributedSearch
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  Nodes expanded between two checks of the incoming queues
+    static constexpr std::size_t EXPANSION_BATCH = 16;
+
+    /// \brief  Creates a search over a number of threads
+    /// \param  threadCount The number of threads, calling thread included
+    /// \param  queueCapacity The number of messages a queue holds
+    /// \param  heuristic The heuristic
+    explicit THashDistributedSearch(std::size_t threadCount = std::thread::hardware_concurrency(),
+                                    std::size_t queueCapacity = 4096,
+                                    const HeuristicPolicy& heuristic = HeuristicPolicy())
+    : m_thread_count(std::max<std::size_t>(1, threadCount))
+    , m_heuristic(heuristic)
+    {
+        for (std::size_t worker = 0; worker < m_thread_count; ++worker)
+        {
+            m_workers.emplace_back(new SWorker());
+            m_workers.back()->outboxes.resize(m_thread_count);
+            m_workers.back()->outbox_first.resize(m_thread_count, 0);
+        }
+
+        // m_queues[to * count + from]
+        for (std::size_t queue = 0; queue < m_thread_count * m_thread_count; ++queue)
+            m_queues.emplace_back(new TSpscQueue<SMessage>(queueCapacity));
+    }
+
+    THashDistributedSearch(const THashDistributedSearch&)            = delete;
+    THashDistributedSearch& operator=(const THashDistributedSearch&) = delete;
+
+    /// \brief  Finds one of the shortest path between start and end node
+    /// \param  graph The graph to perform the search on
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return true if a path is found
+    bool GetPath(const Graph& graph, std::vector<TTNode>& path, const TTNode& start, const TTNode& end)
+    {
+        if (!graph.IsReachable(start, end))
+            return false;
+
+        BeginQuery(graph, start, end);
+
+        // The start node is queued before the threads run
+        Relax(*m_workers[GetOwner(start)], start, 0, m_start_index);
+
+        std::vector<std::thread> threads;
+        for (std::size_t worker = 1; worker < m_thread_count; ++worker)
+            threads.emplace_back(&THashDistributedSearch::Run, this, worker);
+
+        Run(0);
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        m_expanded = 0;
+        m_messages = 0;
+        for (const std::unique_ptr<SWorker>& worker : m_workers)
+        {
+            m_expanded += worker->expanded;
+            m_messages += worker->sent.load(std::memory_order_relaxed);
+        }
+
+        if (m_incumbent.load() == INFINITE_COST)
+            return false;
+
+        std::size_t current = m_end_index;
+        path.push_back(graph.GetNodeAt(current));
+        while (current != m_start_index)
+        {
+            current = m_entries[current].parent;
+            path.push_back(graph.GetNodeAt(current));
+        }
+
+        return true;
+    }
+
+    /// \brief  Returns the number of threads, calling thread included
+    std::size_t GetThreadCount() const
+    { return m_thread_count; }
+
+    /// \brief  Returns the number of nodes expanded by the last query
+    std::size_t GetExpandedCount() const
+    { return m_expanded; }
+
+    /// \brief  Returns the number of nodes sent between threads by the last query
+    std::size_t GetMessageCount() const
+    { return m_messages; }
+
+private:
+
+    /// \brief  The cost of the incumbent before a path is found
+    static constexpr PriorityType INFINITE_COST = std::numeric_limits<PriorityType>::max();
+
+    /// \brief  A node reached by another thread, its priority holds its cost
+    struct SMessage
+    {
+        TTNode      node;       ///< The node and its cost
+        std::size_t parent = 0; ///< The index of the node we came from
+    };
+
+    /// \brief  The search data of a node, written by its owner only
+    struct SEntry
+    {
+        std::uint32_t generation = 0; ///< The query that wrote the entry
+        PriorityType  cost       = 0; ///< The best known cost
+        std::size_t   parent     = 0; ///< The index of the node we came from
+    };
+
+    /// \brief  The data of a thread, touched by this thread only
+    ///         except for the message counters
+    struct SWorker
+    {
+        FrontierPolicy                     frontier;        ///< The open list of the owned nodes
+        std::vector<TTNode>                neighbors;       ///< The neighbors of the expanded node
+        std::vector<std::vector<SMessage>> outboxes;        ///< The messages waiting for room, per thread
+        std::vector<std::size_t>           outbox_first;    ///< The first unsent message, per thread
+        std::size_t                        expanded = 0;    ///< The expanded nodes
+        bool                               idle     = true; ///< Tells if counted in m_idle_count
+        char                               padding_0[64];   ///< Keeps the counters on their own line
+        std::atomic<std::size_t>           sent     { 0 };  ///< The messages created
+        std::atomic<std::size_t>           received { 0 };  ///< The messages handled
+        char                               padding_1[64];   ///< Keeps the next worker away
+    };
+
+    /// \brief  Resets the shared state for a new query
+    void BeginQuery(const Graph& graph, const TTNode& start, const TTNode& end)
+    {
+        mp_graph      = &graph;
+        m_end         = end;
+        m_start_index = graph.GetNodeIndex(start);
+        m_end_index   = graph.GetNodeIndex(end);
+
+        if (m_entries.size() < graph.GetNodeCount())
+            m_entries.resize(graph.GetNodeCount());
+
+        // On wrap around, old stamps could collide with the new generation
+        if (++m_generation == 0)
+        {
+            for (SEntry& entry : m_entries)
+                entry.generation = 0;
+
+            m_generation = 1;
+        }
+
+        for (std::unique_ptr<SWorker>& worker : m_workers)
+        {
+            worker->frontier.Clear();
+            worker->expanded = 0;
+            worker->idle     = true;
+            worker->sent.store(0);
+            worker->received.store(0);
+        }
+
+        m_incumbent.store(INFINITE_COST);
+        m_idle_count.store(m_thread_count);
+        m_activations.store(0);
+        m_done.store(false);
+    }
+
+    /// \brief  Returns the thread owning a node
+    std::size_t GetOwner(const TTNode& node) const
+    {
+        const std::uint64_t block_x = static_cast<std::uint64_t>(node.X()) >> BlockBits;
+        const std::uint64_t block_y = static_cast<std::uint64_t>(node.Y()) >> BlockBits;
+        const std::uint64_t hash    = ((block_x << 32) ^ block_y) * 0x9E3779B97F4A7C15ULL;
+
+        return static_cast<std::size_t>((hash >> 32) % m_thread_count);
+    }
+
+    /// \brief  Records a better cost of an owned node and queues it
+    void Relax(SWorker& worker, TTNode node, PriorityType cost, std::size_t parent)
+    {
+        const std::size_t index = mp_graph->GetNodeIndex(node);
+        SEntry&           entry = m_entries[index];
+
+        if (entry.generation == m_generation && entry.cost <= cost)
+            return;
+
+        entry.generation = m_generation;
+        entry.cost       = cost;
+        entry.parent     = parent;
+
+        const PriorityType priority = cost + m_heuristic.Compute(node, m_end);
+        if (priority >= m_incumbent.load(std::memory_order_relaxed))
+            return;
+
+        if (worker.idle)
+        {
+            // Not counted idle before the activation is published, see DetectTermination
+            worker.idle = false;
+            m_idle_count.fetch_sub(1);
+            m_activations.fetch_add(1);
+        }
+
+        node.SetPriority(priority);
+        worker.frontier.Push(node);
+    }
+
+    /// \brief  Pops and expands one owned node
+    void Expand(SWorker& worker, std::size_t self)
+    {
+        const TTNode      current(worker.frontier.Pop());
+        const std::size_t current_index = mp_graph->GetNodeIndex(current);
+        const SEntry&     entry         = m_entries[current_index];
+
+        // Pushed again with a better cost, or can't improve the incumbent any more
+        if (current.GetPriority() > entry.cost + m_heuristic.Compute(current, m_end) ||
+            current.GetPriority() >= m_incumbent.load(std::memory_order_relaxed))
+            return;
+
+        if (current_index == m_end_index)
+        {
+            PriorityType incumbent = m_incumbent.load();
+            while (entry.cost < incumbent && !m_incumbent.compare_exchange_weak(incumbent, entry.cost))
+            { /* None */ }
+            return;
+        }
+
+        ++worker.expanded;
+
+        const PriorityType current_cost = entry.cost;
+
+        worker.neighbors.clear();
+        mp_graph->GetNeighbors(current, worker.neighbors);
+
+        for (TTNode& next : worker.neighbors)
+        {
+            const PriorityType cost  = current_cost + mp_graph->GetCost(current, next);
+            const std::size_t  owner = GetOwner(next);
+
+            if (owner == self)
+            {
+                Relax(worker, next, cost, current_index);
+                continue;
+            }
+
+            if (cost + m_heuristic.Compute(next, m_end) >= m_incumbent.load(std::memory_order_relaxed))
+                continue;
+
+            SMessage message;
+            message.node   = next;
+            message.parent = current_index;
+            message.node.SetPriority(cost);
+
+            worker.outboxes[owner].push_back(message);
+            worker.sent.store(worker.sent.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    /// \brief  Moves the waiting messages to the queues with room
+    /// \return true if all messages are sent
+    bool Flush(SWorker& worker, std::size_t self)
+    {
+        bool flushed = true;
+
+        for (std::size_t to = 0; to < m_thread_count; ++to)
+        {
+            std::vector<SMessage>& outbox = worker.outboxes[to];
+            std::size_t&           first  = worker.outbox_first[to];
+            TSpscQueue<SMessage>&  queue  = *m_queues[to * m_thread_count + self];
+
+            while (first < outbox.size() && queue.TryPush(outbox[first]))
+                ++first;
+
+            if (first == outbox.size())
+            {
+                outbox.clear();
+                first = 0;
+            }
+            else
+            {
+                flushed = false;
+            }
+        }
+
+        return flushed;
+    }
+
+    /// \brief  Handles the incoming messages
+    void Receive(SWorker& worker, std::size_t self)
+    {
+        SMessage message;
+
+        for (std::size_t from = 0; from < m_thread_count; ++from)
+        {
+            TSpscQueue<SMessage>& queue = *m_queues[self * m_thread_count + from];
+
+            while (queue.TryPop(message))
+            {
+                Relax(worker, message.node, message.node.GetPriority(), message.parent);
+                worker.received.store(worker.received.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+        }
+    }
+
+    /// \brief  Tells if the search is over, called by idle threads
+    ///
+    ///         A thread leaves the idle count, then publishes an activation,
+    ///         then handles its message. If the idle count reads full and
+    ///         the activations did not change around the reads of the
+    ///         counters, no thread had work nor received anything during
+    ///         the reads. Idle threads send nothing, the counters were
+    ///         frozen and equal sums mean no message is left.
+    ///
+    /// \return true if all threads are idle and no message is in flight
+    bool DetectTermination()
+    {
+        const std::size_t activations = m_activations.load();
+
+        if (m_idle_count.load() != m_thread_count)
+            return false;
+
+        std::size_t sent     = 0;
+        std::size_t received = 0;
+        for (const std::unique_ptr<SWorker>& worker : m_workers)
+        {
+            sent     += worker->sent.load(std::memory_order_acquire);
+            received += worker->received.load(std::memory_order_acquire);
+        }
+
+        if (sent != received || m_activations.load() != activations)
+            return false;
+
+        m_done.store(true);
+        return true;
+    }
+
+    /// \brief  Loop of a thread
+    void Run(std::size_t self)
+    {
+        SWorker& worker = *m_workers[self];
+
+        while (!m_done.load(std::memory_order_acquire))
+        {
+            Receive(worker, self);
+
+            for (std::size_t n = 0; n < EXPANSION_BATCH && !worker.frontier.IsEmpty(); ++n)
+                Expand(worker, self);
+
+            const bool flushed = Flush(worker, self);
+            if (!worker.frontier.IsEmpty())
+                continue;
+
+            if (!worker.idle)
+            {
+                worker.idle = true;
+                m_idle_count.fetch_add(1);
+            }
+
+            if (!flushed || !DetectTermination())
+                std::this_thread::yield();
+        }
+    }
+
+    std::size_t                                        m_thread_count;          ///< The number of threads
+    HeuristicPolicy                                    m_heuristic;             ///< The heuristic
+    std::vector<std::unique_ptr<SWorker>>              m_workers;               ///< The data of each thread
+    std::vector<std::unique_ptr<TSpscQueue<SMessage>>> m_queues;                ///< One queue per pair of threads
+    std::vector<SEntry>                                m_entries;               ///< One entry per node
+    std::uint32_t                                      m_generation  = 0;       ///< The current query
+    const Graph*                                       mp_graph      = nullptr; ///< The searched graph
+    TTNode                                             m_end;                   ///< The end node
+    std::size_t                                        m_start_index = 0;       ///< The index of the start node
+    std::size_t                                        m_end_index   = 0;       ///< The index of the end node
+    std::size_t                                        m_expanded    = 0;       ///< The expanded nodes of the last query
+    std::size_t                                        m_messages    = 0;       ///< The sent nodes of the last query
+    std::atomic<PriorityType>                          m_incumbent   { INFINITE_COST }; ///< The cost of the best path found
+    std::atomic<std::size_t>                           m_idle_count  { 0 };     ///< The threads out of nodes
+    std::atomic<std::size_t>                           m_activations { 0 };     ///< Incremented when a thread gets nodes again
+    std::atomic<bool>                                  m_done        { false }; ///< Tells the threads to exit
+};
+
+template<typename Graph, typename CoordinateType, typename PriorityType,
+         typename HeuristicPolicy, typename FrontierPolicy, unsigned BlockBits>
+constexpr std::size_t THashDistributedSearch<Graph, CoordinateType, PriorityType, HeuristicPolicy, FrontierPolicy, BlockBits>::EXPANSION_BATCH;
+
+template<typename Graph, typename CoordinateType, typename PriorityType,
+         typename HeuristicPolicy, typename FrontierPolicy, unsigned BlockBits>
+constexpr PriorityType THashDistributedSearch<Graph, CoordinateType, PriorityType, HeuristicPolicy, FrontierPolicy, BlockBits>::INFINITE_COST;
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_HASH_DISTRIBUTED_SEARCH_HPP
@@ -0,0 +1,96 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       THeuristic.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_HEURISTIC_HPP
+#define PATHFINDING_T_HEURISTIC_HPP
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "TNode.hpp"
+#include "TMovePolicy.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief Computes the manhattan distance between two nodes
+template<typename CoordinateType, typename PriorityType>
+/* inline */ PriorityType Heuristic(const TNode<CoordinateType, PriorityType> &lhs,
+                                    const TNode<CoordinateType, PriorityType> &rhs)
+{
+    return abs(lhs.X() - rhs.X()) + abs(lhs.Y() - rhs.Y());
+}
+
+/// \brief  Manhattan distance, admissible for 4 way moves only
+///         Node costs are at least 1, all heuristics are
+///         admissible on weighted grids too
+/// \tparam Moves The move policy of the grid
+template<typename CoordinateType, typename PriorityType, typename Moves = TFourWayMoves<PriorityType>>
+struct TManhattanHeuristic
+{
+    /* inline */ static PriorityType Compute(const TNode<CoordinateType, PriorityType>& lhs,
+                                             const TNode<CoordinateType, PriorityType>& rhs)
+    {
+        return Moves::STRAIGHT_COST * Heuristic<CoordinateType, PriorityType>(lhs, rhs);
+    }
+};
+
+/// \brief  Octile distance, the exact distance on an open 8 way grid
+/// \tparam Moves The move policy of the grid
+template<typename CoordinateType, typename PriorityType, typename Moves = TEightWayMoves<PriorityType>>
+struct TOctileHeuristic
+{
+    /* inline */ static PriorityType Compute(const TNode<CoordinateType, PriorityType>& lhs,
+                                             const TNode<CoordinateType, PriorityType>& rhs)
+    {
+        const int dx = abs(lhs.X() - rhs.X());
+        const int dy = abs(lhs.Y() - rhs.Y());
+
+        if (!Moves::DIAGONAL)
+            return Moves::STRAIGHT_COST * (dx + dy);
+
+        return Moves::STRAIGHT_COST * std::max(dx, dy) + (Moves::DIAGONAL_COST - Moves::STRAIGHT_COST) * std::min(dx, dy);
+    }
+};
+
+/// \brief  Euclidean distance, scaled down when the diagonal
+///         cost is rounded below sqrt(2) to stay admissible
+/// \tparam Moves The move policy of the grid
+template<typename CoordinateType, typename PriorityType, typename Moves = TEightWayMoves<PriorityType>>
+struct TEuclideanHeuristic
+{
+    /* inline */ static PriorityType Compute(const TNode<CoordinateType, PriorityType>& lhs,
+                                             const TNode<CoordinateType, PriorityType>& rhs)
+    {
+        const double dx    = lhs.X() - rhs.X();
+        const double dy    = lhs.Y() - rhs.Y();
+        const double scale = std::min<double>(Moves::STRAIGHT_COST, Moves::DIAGONAL_COST / std::sqrt(2.0));
+
+        return static_cast<PriorityType>(std::floor(scale * std::sqrt(dx * dx + dy * dy)));
+    }
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_HEURISTIC_HPP
@@ -0,0 +1,231 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       THierarchicalGrid.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_HIERARCHICAL_GRID_HPP
+#define PATHFINDING_T_HIERARCHICAL_GRID_HPP
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstdlib>
+
+#include "TNode.hpp"
+#include "TSquareGrid.hpp"
+#include "TSearchState.hpp"
+#include "TPathfinding.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  THierarchicalGrid
+/// \brief  HPA* abstraction layer over a TSquareGrid
+///
+///         The grid is split in square clusters. Entrances are placed on
+///         the open parts of cluster borders and the costs between the
+///         entrances of a cluster are precomputed. A query searches the
+///         abstract graph of entrances, then refines only the clusters
+///         crossed by the abstract path. Paths are near optimal.
+///
+///         Connectivity and terrain cost edits must go through
+///         SetNodeNeighbors and SetNodeCost so that the clusters
+///         touching the edited node are rebuilt. Editing the grid
+///         directly leaves the cached entrance costs stale.
+///
+/// \tparam CoordinateType The type of the coordinate system
+/// \tparam PriorityType   The type of the priority
+template <typename CoordinateType, typename PriorityType>
+class THierarchicalGrid
+{
+public:
+
+    using TTNode        = TNode        <CoordinateType, PriorityType>;
+    using TTSquareGrid  = TSquareGrid  <CoordinateType, PriorityType>;
+    using TTSearchState = TSearchState <CoordinateType, PriorityType>;
+
+    /// \class  TClusterView
+    /// \brief  The grid restricted to a single cluster
+    class TClusterView
+    {
+    public:
+
+        /// \brief  Constructs a view on a cluster of a hierarchical grid
+        /// \param  owner The hierarchical grid
+        /// \param  cluster The index of the cluster
+        TClusterView(const THierarchicalGrid& owner, std::size_t cluster);
+
+        /// \brief  Puts into neighbors the direct neighbors inside the cluster
+        inline void GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const;
+
+        /// \brief  Graph interface, forwarded to the grid
+        inline bool           IsReachable  (const TTNode& from, const TTNode& to) const;
+        inline PriorityType   GetCost      (const TTNode& from, const TTNode& to) const;
+        inline std::size_t    GetNodeIndex (const TTNode& node) const;
+        inline std::size_t    GetNodeCount () const;
+        inline const TTNode & GetNodeAt    (std::size_t index) const;
+
+    private:
+
+        const THierarchicalGrid& m_owner;   ///< The hierarchical grid
+        std::size_t              m_cluster; ///< The index of the cluster
+    };
+
+    /// \class  TAbstractGraph
+    /// \brief  The graph of entrances of one query
+    ///
+    ///         Nodes are grid nodes, start and end are linked to the
+    ///         entrances of their cluster for the time of the query.
+    class TAbstractGraph
+    {
+    public:
+
+        /// \brief  Connects start and end to the abstract graph
+        /// \param  owner The hierarchical grid
+        /// \param  start The start node
+        /// \param  end The end node
+        TAbstractGraph(const THierarchicalGrid& owner, const TTNode& start, const TTNode& end);
+
+        /// \brief  Puts into neighbors the nodes linked to current
+        inline void GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const;
+
+        /// \brief  Returns the cost of an abstract edge
+        inline PriorityType GetCost(const TTNode& from, const TTNode& to) const;
+
+        /// \brief  Graph interface, nodes are indexed as grid nodes
+        inline bool           IsReachable  (const TTNode& from, const TTNode& to) const;
+        inline std::size_t    GetNodeIndex (const TTNode& node) const;
+        inline std::size_t    GetNodeCount () const;
+        inline const TTNode & GetNodeAt    (std::size_t index) const;
+
+    private:
+
+        const THierarchicalGrid&  m_owner;         ///< The hierarchical grid
+        std::size_t               m_start;         ///< The index of the start node
+        std::size_t               m_end;           ///< The index of the end node
+        bool                      m_start_linked;  ///< True if start isn't an entrance
+        bool                      m_end_linked;    ///< True if end isn't an entrance
+        PriorityType              m_direct;        ///< Start to end cost inside a shared cluster
+        std::vector<PriorityType> m_start_costs;   ///< Start to each entrance of its cluster
+        std::vector<PriorityType> m_end_costs;     ///< Each entrance of its cluster to end
+    };
+
+    /// \brief  Builds the clusters over a grid
+    ///         The grid must outlive the hierarchical grid
+    /// \param  grid The grid to abstract
+    /// \param  clusterSize The width and height of a cluster
+    void Initialize(TTSquareGrid& grid, CoordinateType clusterSize);
+
+    /// \brief  Sets the neighbors of a node and rebuilds
+    ///         the clusters whose entrances or costs may change
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  flag The flag to apply
+    void SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag);
+
+    /// \brief  Sets the terrain cost of a node and rebuilds
+    ///         the clusters whose entrance costs may change
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  cost The cost to enter the node, at least 1
+    void SetNodeCost(CoordinateType x, CoordinateType y, unsigned char cost);
+
+    /// \brief  Finds a path between start and end node
+    /// \param  state The scratch state of the search, reused between queries
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return true if a path is found
+    bool GetPath(TTSearchState& state, std::vector<TTNode>& path, const TTNode& start, const TTNode& end) const;
+
+    /// \brief  Returns the number of clusters
+    /// \return The number of clusters
+    inline std::size_t GetClusterCount() const;
+
+    /// \brief  Returns the number of entrances of all clusters
+    /// \return The number of abstract nodes
+    inline std::size_t GetEntranceCount() const;
+
+    /// \brief  Returns the underlying grid
+    /// \return A read only reference on the grid
+    inline const TTSquareGrid& GetGrid() const;
+
+private:
+
+    /// \brief  Borders longer than this get two entrances, one at each end
+    static constexpr int MAX_SINGLE_ENTRANCE_WIDTH = 6;
+
+    /// \brief  Value of unreachable entries
+    static constexpr PriorityType UNREACHABLE = std::numeric_limits<PriorityType>::max();
+
+    /// \brief  Stores the entrances of a cluster and the costs between them
+    struct SCluster
+    {
+        int x0 = 0, y0 = 0; ///< The first node of the cluster
+        int x1 = 0, y1 = 0; ///< One past the last node of the cluster
+
+        std::vector<std::size_t>  entrances; ///< The index of the entrance nodes
+        std::vector<PriorityType> costs;     ///< entrances x entrances costs
+    };
+
+    /// \brief  Rebuilds the cluster of a node and the clusters it borders
+    void RebuildClusters(int x, int y);
+
+    /// \brief  Recomputes the entrances and costs of a cluster
+    void BuildCluster(std::size_t cluster);
+
+    /// \brief  Adds the entrances of the border of a cluster in direction dx, dy
+    void AddBorderEntrances(std::size_t cluster, int dx, int dy);
+
+    /// \brief  Adds a node to the entrances of its cluster
+    void AddEntrance(std::size_t cluster, int x, int y);
+
+    /// \brief  Computes the costs from a node to every node of its cluster
+    /// \param  cluster The cluster of the node
+    /// \param  source The index of the node
+    /// \param  costs The costs, indexed by local node (see GetLocalIndex)
+    void ComputeCosts(std::size_t cluster, std::size_t source, std::vector<PriorityType>& costs) const;
+
+    /// \brief  Tells if the edge between (x, y) and (x + dx, y + dy) exists
+    inline bool HasEdge(int x, int y, int dx, int dy) const;
+
+    /// \brief  Returns the index of the cluster containing (x, y)
+    inline std::size_t GetClusterIndex(int x, int y) const;
+
+    /// \brief  Returns the index of the cluster containing a node
+    inline std::size_t GetClusterIndex(std::size_t node) const;
+
+    /// \brief  Returns the index of a node inside its cluster
+    inline std::size_t GetLocalIndex(const SCluster& cluster, std::size_t node) const;
+
+    TTSquareGrid*             mp_grid        = nullptr; ///< The abstracted grid
+    int                       m_cluster_size = 0;       ///< The size of a cluster
+    int                       m_clusters_x   = 0;       ///< The number of clusters on X
+    int                       m_clusters_y   = 0;       ///< The number of clusters on Y
+    std::vector<SCluster>     m_clusters;               ///< All clusters
+    std::vector<std::int32_t> m_entrance_of;            ///< Per node, its entrance index in its cluster or -1
+};
+
+} // !namespace
+
+#include "THierarchicalGrid.inl"
+
+#endif // PATHFINDING_T_HIERARCHICAL_GRID_HPP
@@ -0,0 +1,587 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       THierarchicalGrid.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <queue>
+#include <utility>
+#include <functional>
+
+/// \namespace nav
+namespace nav
+{
+
+template <typename CoordinateType, typename PriorityType>
+constexpr int THierarchicalGrid<CoordinateType, PriorityType>::MAX_SINGLE_ENTRANCE_WIDTH;
+
+template <typename CoordinateType, typename PriorityType>
+constexpr PriorityType THierarchicalGrid<CoordinateType, PriorityType>::UNREACHABLE;
+
+/// \brief  Builds the clusters over a grid
+/// \param  grid The grid to abstract
+/// \param  clusterSize The width and height of a cluster
+template <typename CoordinateType, typename PriorityType>
+void THierarchicalGrid<CoordinateType, PriorityType>::Initialize(TTSquareGrid& grid, CoordinateType clusterSize)
+{
+    mp_grid        = &grid;
+    m_cluster_size = clusterSize;
+    m_clusters_x   = (grid.GetWidth()  + m_cluster_size - 1) / m_cluster_size;
+    m_clusters_y   = (grid.GetHeight() + m_cluster_size - 1) / m_cluster_size;
+
+    m_entrance_of.assign(grid.GetNodeCount(), -1);
+    m_clusters.clear();
+    m_clusters.resize(static_cast<std::size_t>(m_clusters_x) * m_clusters_y);
+
+    for (int cy = 0; cy < m_clusters_y; ++cy)
+    {
+        for (int cx = 0; cx < m_clusters_x; ++cx)
+        {
+            SCluster& cluster = m_clusters[static_cast<std::size_t>(cy) * m_clusters_x + cx];
+            cluster.x0 = cx * m_cluster_size;
+            cluster.y0 = cy * m_cluster_size;
+            cluster.x1 = std::min(cluster.x0 + m_cluster_size, static_cast<int>(grid.GetWidth()));
+            cluster.y1 = std::min(cluster.y0 + m_cluster_size, static_cast<int>(grid.GetHeight()));
+        }
+    }
+
+    for (std::size_t cluster = 0; cluster < m_clusters.size(); ++cluster)
+    {
+        BuildCluster(cluster);
+    }
+}
+
+/// \brief  Sets the neighbors of a node and rebuilds
+///         the clusters whose entrances or costs may change
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+/// \param  flag The flag to apply
+template <typename CoordinateType, typename PriorityType>
+void THierarchicalGrid<CoordinateType, PriorityType>::SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag)
+{
+    mp_grid->SetNodeNeighbors(x, y, flag);
+    RebuildClusters(x, y);
+}
+
+/// \brief  Sets the terrain cost of a node and rebuilds
+///         the clusters whose entrance costs may change
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+/// \param  cost The cost to enter the node, at least 1
+template <typename CoordinateType, typename PriorityType>
+void THierarchicalGrid<CoordinateType, PriorityType>::SetNodeCost(CoordinateType x, CoordinateType y, unsigned char cost)
+{
+    mp_grid->SetNodeCost(x, y, cost);
+    RebuildClusters(x, y);
+}
+
+/// \brief  Rebuilds the cluster of a node and the clusters it borders
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+template <typename CoordinateType, typename PriorityType>
+void THierarchicalGrid<CoordinateType, PriorityType>::RebuildClusters(int x, int y)
+{
+    static const int directions[4][2] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 } };
+
+    // The edges of the node may cross the border of its cluster,
+    // the entrances on the other side have to be rebuilt too
+    const std::size_t cluster = GetClusterIndex(x, y);
+    BuildCluster(cluster);
+
+    for (const int* direction : directions)
+    {
+        const int nx = x + direction[0];
+        const int ny = y + direction[1];
+
+        if (nx >= 0 && nx < mp_grid->GetWidth() && ny >= 0 && ny < mp_grid->GetHeight())
+        {
+            const std::size_t neighbor = GetClusterIndex(nx, ny);
+            if (neighbor != cluster)
+            {
+                BuildCluster(neighbor);
+            }
+        }
+    }
+}
+
+/// \brief  Finds a path between start and end node
+/// \param  state The scratch state of the search, reused between queries
+/// \param  path The vector to store the result (in reverse order)
+/// \param  start The start node
+/// \param  end The end node
+/// \return true if a path is found
+template <typename CoordinateType, typename PriorityType>
+bool THierarchicalGrid<CoordinateType, PriorityType>::GetPath(TTSearchState& state, std::vector<TTNode>& path, const TTNode& start, const TTNode& end) const
+{
+    std::vector<TTNode> abstract_path;
+    std::vector<TTNode> segment;
+
+    // Checked before linking start and end to their clusters
+    if (!mp_grid->IsReachable(start, end))
+        return false;
+
+    TAbstractGraph abstract_graph(*this, start, end);
+    if (!TPathfinding<TAbstractGraph, CoordinateType, PriorityType>::GetPath(abstract_graph, state, abstract_path, start, end))
+    {
+        return false;
+    }
+
+    // Refines the abstract path backward, as it is stored
+    const std::size_t entry_size = path.size();
+    path.push_back(end);
+    for (std::size_t n = 0; n + 1 < abstract_path.size(); ++n)
+    {
+        const TTNode& to   = abstract_path[n];
+        const TTNode& from = abstract_path[n + 1];
+
+        const std::size_t cluster = GetClusterIndex(mp_grid->GetNodeIndex(from));
+        if (cluster != GetClusterIndex(mp_grid->GetNodeIndex(to)))
+        {
+            // Edge between two entrances of adjacent clusters
+            path.push_back(mp_grid->GetNode(from.X(), from.Y()));
+            continue;
+        }
+
+        // Fails if the grid was edited after the clusters were built
+        segment.clear();
+        if (!TPathfinding<TClusterView, CoordinateType, PriorityType>::GetPath(
+                TClusterView(*this, cluster), state, segment,
+                mp_grid->GetNode(from.X(), from.Y()), to))
+        {
+            path.resize(entry_size);
+            return false;
+        }
+
+        path.insert(path.end(), segment.begin() + 1, segment.end());
+    }
+
+    return true;
+}
+
+/// \brief  Returns the number of clusters
+/// \return The number of clusters
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::GetClusterCount() const
+{
+    return m_clusters.size();
+}
+
+/// \brief  Returns the number of entrances of all clusters
+/// \return The number of abstract nodes
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::GetEntranceCount() const
+{
+    std::size_t count = 0;
+    for (const SCluster& cluster : m_clusters)
+        count += cluster.entrances.size();
+
+    return count;
+}
+
+/// \brief  Returns the underlying grid
+/// \return A read only reference on the grid
+template <typename CoordinateType, typename PriorityType>
+inline const TSquareGrid<CoordinateType, PriorityType>& THierarchicalGrid<CoordinateType, PriorityType>::GetGrid() const
+{
+    return *mp_grid;
+}
+
+/// \brief  Recomputes the entrances and costs of a cluster
+/// \param  cluster The index of the cluster
+template <typename CoordinateType, typename PriorityType>
+void THierarchicalGrid<CoordinateType, PriorityType>::BuildCluster(std::size_t cluster)
+{
+    SCluster& current = m_clusters[cluster];
+
+    for (std::size_t node : current.entrances)
+        m_entrance_of[node] = -1;
+
+    current.entrances.clear();
+
+    AddBorderEntrances(cluster,  0, -1);
+    AddBorderEntrances(cluster,  1,  0);
+    AddBorderEntrances(cluster,  0,  1);
+    AddBorderEntrances(cluster, -1,  0);
+
+    const std::size_t count = current.entrances.size();
+    current.costs.assign(count * count, UNREACHABLE);
+
+    std::vector<PriorityType> costs;
+    for (std::size_t from = 0; from < count; ++from)
+    {
+        ComputeCosts(cluster, current.entrances[from], costs);
+
+        for (std::size_t to = 0; to < count; ++to)
+            current.costs[from * count + to] = costs[GetLocalIndex(current, current.entrances[to])];
+    }
+}
+
+/// \brief  Adds the entrances of the border of a cluster in direction dx, dy
+///         The same nodes are chosen from both sides of a border
+/// \param  cluster The index of the cluster
+/// \param  dx The X direction of the border
+/// \param  dy The Y direction of the border
+template <typename CoordinateType, typename PriorityType>
+void THierarchicalGrid<CoordinateType, PriorityType>::AddBorderEntrances(std::size_t cluster, int dx, int dy)
+{
+    const SCluster& current = m_clusters[cluster];
+
+    // The first node of the border and the direction along it
+    const int x0 = (dx > 0) ? current.x1 - 1 : current.x0;
+    const int y0 = (dy > 0) ? current.y1 - 1 : current.y0;
+    const int ax = (dx != 0) ? 0 : 1;
+    const int ay = (dx != 0) ? 1 : 0;
+    const int length = (dx != 0) ? current.y1 - current.y0 : current.x1 - current.x0;
+
+    // A run is a set of open edges whose nodes are also linked along
+    // the border on both sides, so one entrance can serve the whole run
+    int run_start = -1;
+    for (int n = 0; n <= length; ++n)
+    {
+        const int  x    = x0 + n * ax;
+        const int  y    = y0 + n * ay;
+        const bool open = (n < length) && HasEdge(x, y, dx, dy);
+        const bool link = open && run_start >= 0 &&
+                          HasEdge(x - ax,      y - ay,      ax, ay) &&
+                          HasEdge(x - ax + dx, y - ay + dy, ax, ay);
+
+        if (run_start >= 0 && !link)
+        {
+            const int run_end = n - 1;
+            if (run_end - run_start + 1 < MAX_SINGLE_ENTRANCE_WIDTH)
+            {
+                const int middle = (run_start + run_end) / 2;
+                AddEntrance(cluster, x0 + middle * ax, y0 + middle * ay);
+            }
+            else
+            {
+                AddEntrance(cluster, x0 + run_start * ax, y0 + run_start * ay);
+                AddEntrance(cluster, x0 + run_end   * ax, y0 + run_end   * ay);
+            }
+
+            run_start = -1;
+        }
+
+        if (open && run_start < 0)
+        {
+            run_start = n;
+        }
+    }
+}
+
+/// \brief  Adds a node to the entrances of its cluster
+/// \param  cluster The index of the cluster
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+template <typename CoordinateType, typename PriorityType>
+void THierarchicalGrid<CoordinateType, PriorityType>::AddEntrance(std::size_t cluster, int x, int y)
+{
+    const std::size_t node = static_cast<std::size_t>(y) * mp_grid->GetWidth() + x;
+
+    // Corner nodes may be an entrance of two borders
+    if (m_entrance_of[node] < 0)
+    {
+        m_entrance_of[node] = static_cast<std::int32_t>(m_clusters[cluster].entrances.size());
+        m_clusters[cluster].entrances.push_back(node);
+    }
+}
+
+/// \brief  Computes the costs from a node to every node of its cluster
+/// \param  cluster The cluster of the node
+/// \param  source The index of the node
+/// \param  costs The costs, indexed by local node (see GetLocalIndex)
+template <typename CoordinateType, typename PriorityType>
+void THierarchicalGrid<CoordinateType, PriorityType>::ComputeCosts(std::size_t cluster, std::size_t source, std::vector<PriorityType>& costs) const
+{
+    using TTEntry = std::pair<PriorityType, std::size_t>;
+
+    const SCluster&    current = m_clusters[cluster];
+    const TClusterView view(*this, cluster);
+
+    std::vector<TTNode> neighbors;
+    std::priority_queue<TTEntry, std::vector<TTEntry>, std::greater<TTEntry>> frontier;
+
+    costs.assign(static_cast<std::size_t>(current.x1 - current.x0) * (current.y1 - current.y0), UNREACHABLE);
+    costs[GetLocalIndex(current, source)] = 0;
+    frontier.emplace(0, source);
+
+    while (!frontier.empty())
+    {
+        const TTEntry entry = frontier.top();
+        frontier.pop();
+
+        if (entry.first > costs[GetLocalIndex(current, entry.second)])
+            continue;
+
+        const TTNode& node = mp_grid->GetNodeAt(entry.second);
+
+        neighbors.clear();
+        view.GetNeighbors(node, neighbors);
+
+        for (const TTNode& next : neighbors)
+        {
+            const std::size_t  index    = mp_grid->GetNodeIndex(next);
+            const PriorityType new_cost = entry.first + mp_grid->GetCost(node, next);
+            PriorityType&      cost     = costs[GetLocalIndex(current, index)];
+
+            if (new_cost < cost)
+            {
+                cost = new_cost;
+                frontier.emplace(new_cost, index);
+            }
+        }
+    }
+}
+
+/// \brief  Tells if the edge between (x, y) and (x + dx, y + dy) exists
+template <typename CoordinateType, typename PriorityType>
+inline bool THierarchicalGrid<CoordinateType, PriorityType>::HasEdge(int x, int y, int dx, int dy) const
+{
+    const TTSquareGrid& grid = *mp_grid;
+
+    return TMoveRules<TTNode, typename TTSquareGrid::TTMoves>::HasEdge(x, y, dx, dy,
+        [&grid](int fx, int fy) -> unsigned char
+        {
+            const CoordinateType cx = static_cast<CoordinateType>(fx);
+            const CoordinateType cy = static_cast<CoordinateType>(fy);
+            return grid.IsValidNode(cx, cy) ? grid.GetNode(cx, cy).GetNeighborFlags() : 0;
+        });
+}
+
+/// \brief  Returns the index of the cluster containing (x, y)
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::GetClusterIndex(int x, int y) const
+{
+    return static_cast<std::size_t>(y / m_cluster_size) * m_clusters_x + x / m_cluster_size;
+}
+
+/// \brief  Returns the index of the cluster containing a node
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::GetClusterIndex(std::size_t node) const
+{
+    const int width = mp_grid->GetWidth();
+    return GetClusterIndex(static_cast<int>(node % width), static_cast<int>(node / width));
+}
+
+/// \brief  Returns the index of a node inside its cluster
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::GetLocalIndex(const SCluster& cluster, std::size_t node) const
+{
+    const int width = mp_grid->GetWidth();
+    const int x     = static_cast<int>(node % width) - cluster.x0;
+    const int y     = static_cast<int>(node / width) - cluster.y0;
+
+    return static_cast<std::size_t>(y) * (cluster.x1 - cluster.x0) + x;
+}
+
+/// \brief  Constructs a view on a cluster of a hierarchical grid
+/// \param  owner The hierarchical grid
+/// \param  cluster The index of the cluster
+template <typename CoordinateType, typename PriorityType>
+THierarchicalGrid<CoordinateType, PriorityType>::TClusterView::TClusterView(const THierarchicalGrid& owner, std::size_t cluster)
+: m_owner(owner), m_cluster(cluster)
+{ /* None */ }
+
+/// \brief  Puts into neighbors the direct neighbors inside the cluster
+template <typename CoordinateType, typename PriorityType>
+inline void THierarchicalGrid<CoordinateType, PriorityType>::TClusterView::GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const
+{
+    const SCluster&   cluster = m_owner.m_clusters[m_cluster];
+    const std::size_t first   = neighbors.size();
+
+    m_owner.mp_grid->GetNeighbors(current, neighbors);
+
+    auto outside = [&cluster](const TTNode& node)
+    {
+        return node.X() < cluster.x0 || node.X() >= cluster.x1 ||
+               node.Y() < cluster.y0 || node.Y() >= cluster.y1;
+    };
+
+    neighbors.erase(std::remove_if(neighbors.begin() + first, neighbors.end(), outside), neighbors.end());
+}
+
+template <typename CoordinateType, typename PriorityType>
+inline bool THierarchicalGrid<CoordinateType, PriorityType>::TClusterView::IsReachable(const TTNode& /* from */, const TTNode& /* to */) const
+{ return true; /* Components are known for the whole grid only */ }
+
+template <typename CoordinateType, typename PriorityType>
+inline PriorityType THierarchicalGrid<CoordinateType, PriorityType>::TClusterView::GetCost(const TTNode& from, const TTNode& to) const
+{ return m_owner.mp_grid->GetCost(from, to); }
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::TClusterView::GetNodeIndex(const TTNode& node) const
+{ return m_owner.mp_grid->GetNodeIndex(node); }
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::TClusterView::GetNodeCount() const
+{ return m_owner.mp_grid->GetNodeCount(); }
+
+template <typename CoordinateType, typename PriorityType>
+inline const TNode<CoordinateType, PriorityType>& THierarchicalGrid<CoordinateType, PriorityType>::TClusterView::GetNodeAt(std::size_t index) const
+{ return m_owner.mp_grid->GetNodeAt(index); }
+
+/// \brief  Connects start and end to the abstract graph
+/// \param  owner The hierarchical grid
+/// \param  start The start node
+/// \param  end The end node
+template <typename CoordinateType, typename PriorityType>
+THierarchicalGrid<CoordinateType, PriorityType>::TAbstractGraph::TAbstractGraph(const THierarchicalGrid& owner, const TTNode& start, const TTNode& end)
+: m_owner       (owner)
+, m_start       (owner.mp_grid->GetNodeIndex(start))
+, m_end         (owner.mp_grid->GetNodeIndex(end))
+, m_start_linked(owner.m_entrance_of[m_start] < 0)
+, m_end_linked  (owner.m_entrance_of[m_end]   < 0)
+, m_direct      (UNREACHABLE)
+{
+    std::vector<PriorityType> costs;
+
+    const std::size_t start_cluster = owner.GetClusterIndex(m_start);
+    const std::size_t end_cluster   = owner.GetClusterIndex(m_end);
+
+    if (m_start_linked)
+    {
+        const SCluster& cluster = owner.m_clusters[start_cluster];
+        owner.ComputeCosts(start_cluster, m_start, costs);
+
+        for (std::size_t entrance : cluster.entrances)
+            m_start_costs.push_back(costs[owner.GetLocalIndex(cluster, entrance)]);
+
+        if (start_cluster == end_cluster)
+            m_direct = costs[owner.GetLocalIndex(cluster, m_end)];
+    }
+
+    if (m_end_linked)
+    {
+        // Moves are symmetric but a move costs the node it enters :
+        // the reversed path enters end instead of the entrance
+        const SCluster&     cluster  = owner.m_clusters[end_cluster];
+        const TTSquareGrid& grid     = *owner.mp_grid;
+        const PriorityType  end_cost = grid.GetNodeCost(grid.GetNodeAt(m_end).X(), grid.GetNodeAt(m_end).Y());
+        owner.ComputeCosts(end_cluster, m_end, costs);
+
+        for (std::size_t entrance : cluster.entrances)
+        {
+            const PriorityType cost = costs[owner.GetLocalIndex(cluster, entrance)];
+            const TTNode&      node = grid.GetNodeAt(entrance);
+
+            m_end_costs.push_back(cost == UNREACHABLE ? UNREACHABLE
+                                  : static_cast<PriorityType>(cost - grid.GetNodeCost(node.X(), node.Y()) + end_cost));
+        }
+    }
+}
+
+/// \brief  Puts into neighbors the nodes linked to current
+template <typename CoordinateType, typename PriorityType>
+inline void THierarchicalGrid<CoordinateType, PriorityType>::TAbstractGraph::GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const
+{
+    static const int directions[4][2] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 } };
+
+    const TTSquareGrid& grid    = *m_owner.mp_grid;
+    const std::size_t   node    = grid.GetNodeIndex(current);
+    const std::size_t   index   = m_owner.GetClusterIndex(node);
+    const SCluster&     cluster = m_owner.m_clusters[index];
+
+    if (node == m_start && m_start_linked)
+    {
+        for (std::size_t n = 0; n < cluster.entrances.size(); ++n)
+        {
+            if (m_start_costs[n] != UNREACHABLE)
+                neighbors.push_back(grid.GetNodeAt(cluster.entrances[n]));
+        }
+
+        if (m_end_linked && m_direct != UNREACHABLE)
+            neighbors.push_back(grid.GetNodeAt(m_end));
+
+        return;
+    }
+
+    const std::size_t entrance = static_cast<std::size_t>(m_owner.m_entrance_of[node]);
+    const std::size_t count    = cluster.entrances.size();
+
+    // Entrances of the same cluster
+    for (std::size_t n = 0; n < count; ++n)
+    {
+        if (n != entrance && cluster.costs[entrance * count + n] != UNREACHABLE)
+            neighbors.push_back(grid.GetNodeAt(cluster.entrances[n]));
+    }
+
+    // Entrances of the adjacent clusters
+    for (const int* direction : directions)
+    {
+        const int nx = current.X() + direction[0];
+        const int ny = current.Y() + direction[1];
+
+        if (m_owner.HasEdge(current.X(), current.Y(), direction[0], direction[1]) &&
+            m_owner.GetClusterIndex(nx, ny) != index &&
+            m_owner.m_entrance_of[static_cast<std::size_t>(ny) * grid.GetWidth() + nx] >= 0)
+        {
+            neighbors.push_back(grid.GetNode(static_cast<CoordinateType>(nx), static_cast<CoordinateType>(ny)));
+        }
+    }
+
+    if (m_end_linked && m_owner.GetClusterIndex(m_end) == index && m_end_costs[entrance] != UNREACHABLE)
+        neighbors.push_back(grid.GetNodeAt(m_end));
+}
+
+/// \brief  Returns the cost of an abstract edge
+template <typename CoordinateType, typename PriorityType>
+inline PriorityType THierarchicalGrid<CoordinateType, PriorityType>::TAbstractGraph::GetCost(const TTNode& from, const TTNode& to) const
+{
+    const TTSquareGrid& grid       = *m_owner.mp_grid;
+    const std::size_t   from_index = grid.GetNodeIndex(from);
+    const std::size_t   to_index   = grid.GetNodeIndex(to);
+
+    if (from_index == m_start && m_start_linked)
+    {
+        return (to_index == m_end && m_end_linked)
+               ? m_direct
+               : m_start_costs[static_cast<std::size_t>(m_owner.m_entrance_of[to_index])];
+    }
+
+    if (to_index == m_end && m_end_linked)
+        return m_end_costs[static_cast<std::size_t>(m_owner.m_entrance_of[from_index])];
+
+    const std::size_t cluster = m_owner.GetClusterIndex(from_index);
+    if (cluster != m_owner.GetClusterIndex(to_index))
+        return grid.GetCost(from, to);
+
+    const SCluster&   current = m_owner.m_clusters[cluster];
+    const std::size_t count   = current.entrances.size();
+
+    return current.costs[static_cast<std::size_t>(m_owner.m_entrance_of[from_index]) * count +
+                         static_cast<std::size_t>(m_owner.m_entrance_of[to_index])];
+}
+
+template <typename CoordinateType, typename PriorityType>
+inline bool THierarchicalGrid<CoordinateType, PriorityType>::TAbstractGraph::IsReachable(const TTNode& from, const TTNode& to) const
+{ return m_owner.mp_grid->IsReachable(from, to); }
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::TAbstractGraph::GetNodeIndex(const TTNode& node) const
+{ return m_owner.mp_grid->GetNodeIndex(node); }
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t THierarchicalGrid<CoordinateType, PriorityType>::TAbstractGraph::GetNodeCount() const
+{ return m_owner.mp_grid->GetNodeCount(); }
+
+template <typename CoordinateType, typename PriorityType>
+inline const TNode<CoordinateType, PriorityType>& THierarchicalGrid<CoordinateType, PriorityType>::TAbstractGraph::GetNodeAt(std::size_t index) const
+{ return m_owner.mp_grid->GetNodeAt(index); }
+
+} // !namespace
@@ -0,0 +1,338 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TIncrementalPathfinding.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_INCREMENTAL_PATHFINDING_HPP
+#define PATHFINDING_T_INCREMENTAL_PATHFINDING_HPP
+
+#include <limits>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+
+#include "TNode.hpp"
+#include "TPathfinding.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TIncrementalPathfinding
+/// \brief  D* Lite planner keeping its search state between queries
+///
+///         The search runs backward from the end node. When the grid
+///         connectivity changes, only the g / rhs values of the nodes
+///         around the changed nodes are repaired, the rest of the search
+///         is reused. The start node can move between queries.
+///
+/// \tparam Graph The grid class
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+/// \tparam HeuristicPolicy The heuristic, must match the moves of the graph (see THeuristic.hpp)
+template<typename Graph, typename CoordinateType, typename PriorityType,
+         typename HeuristicPolicy = TManhattanHeuristic<CoordinateType, PriorityType>>
+class TIncrementalPathfinding
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  Starts a new plan, all previous search state is dropped
+    /// \param  graph The grid, must outlive the planner
+    /// \param  start The start node
+    /// \param  end The end node
+    void Initialize(const Graph& graph, const TTNode& start, const TTNode& end)
+    {
+        mp_graph = &graph;
+        m_start  = graph.GetNodeIndex(start);
+        m_last   = m_start;
+        m_end    = graph.GetNodeIndex(end);
+        m_km     = 0;
+
+        m_entries.assign(graph.GetNodeCount(), SEntry());
+        m_frontier.clear();
+
+        m_entries[m_end].rhs = 0;
+        Push(m_end);
+    }
+
+    /// \brief  Moves the start node, typically to the next node of the path
+    /// \param  start The new start node
+    void SetStart(const TTNode& start)
+    {
+        const std::size_t index = mp_graph->GetNodeIndex(start);
+
+        // Keys already queued stay valid lower bounds with this offset
+        m_km    = Add(m_km, Heuristic(m_last, index));
+        m_last  = index;
+        m_start = index;
+    }
+
+    /// \brief  Repairs the search after the neighbors of some nodes changed
+    ///         Must be called after the SetNodeNeighbors calls on the grid
+    /// \param  changed The nodes whose neighbor flags changed
+    void NotifyChanges(const std::vector<TTNode>& changed)
+    {
+        static const int directions[8][2] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 },
+                                              { 1, -1 }, { 1, 1 }, { -1, 1 }, { -1, -1 } };
+
+        for (const TTNode& node : changed)
+        {
+            UpdateNode(mp_graph->GetNodeIndex(node));
+
+            // Edges to the direct neighbors may have been added or removed,
+            // on 8 way grids the diagonals around the node too
+            for (const int* direction : directions)
+            {
+                const int x = node.X() + direction[0];
+                const int y = node.Y() + direction[1];
+
+                if (mp_graph->IsValidNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y)))
+                {
+                    UpdateNode(mp_graph->GetNodeIndex(mp_graph->GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y))));
+                }
+            }
+        }
+    }
+
+    /// \brief  Finds one of the shortest path between the start and end node
+    /// \param  path The vector to store the result (in reverse order)
+    /// \return true if a path is found
+    bool GetPath(std::vector<TTNode>& path)
+    {
+        // The search state is kept for when the components join again
+        if (!mp_graph->IsReachable(mp_graph->GetNodeAt(m_start), mp_graph->GetNodeAt(m_end)))
+            return false;
+
+        ComputeShortestPath();
+
+        if (m_entries[m_start].g == INFINITE_COST)
+            return false;
+
+        // Follows the best successors, then stores from end to start
+        const std::size_t first = path.size();
+        std::size_t current     = m_start;
+
+        path.push_back(mp_graph->GetNodeAt(current));
+        while (current != m_end)
+        {
+            PriorityType best_cost = INFINITE_COST;
+            std::size_t  best      = current;
+
+            m_neighbors.clear();
+            mp_graph->GetNeighbors(mp_graph->GetNodeAt(current), m_neighbors);
+
+            for (const TTNode& next : m_neighbors)
+            {
+                const std::size_t  index = mp_graph->GetNodeIndex(next);
+                const PriorityType cost  = Add(mp_graph->GetCost(mp_graph->GetNodeAt(current), next), m_entries[index].g);
+
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best      = index;
+                }
+            }
+
+            current = best;
+            path.push_back(mp_graph->GetNodeAt(current));
+        }
+
+        std::reverse(path.begin() + first, path.end());
+        return true;
+    }
+
+private:
+
+    /// \brief  Value of unreachable nodes
+    static constexpr PriorityType INFINITE_COST = std::numeric_limits<PriorityType>::max();
+
+    /// \brief  The search data of a node
+    struct SEntry
+    {
+        PriorityType g    = INFINITE_COST; ///< The cost to the end node
+        PriorityType rhs  = INFINITE_COST; ///< One step lookahead of g
+        PriorityType key1 = 0;             ///< Primary key while queued
+        PriorityType key2 = 0;             ///< Secondary key while queued
+        bool         open = false;         ///< Tells if the node is queued
+    };
+
+    /// \brief  A queued node, stale once its key differs from the entry
+    struct SQueued
+    {
+        PriorityType key1;  ///< Primary key
+        PriorityType key2;  ///< Secondary key
+        std::size_t  index; ///< The index of the node
+
+        /// \brief  Reversed to get a min heap
+        bool operator<(const SQueued& other) const
+        { return key1 > other.key1 || (key1 == other.key1 && key2 > other.key2); }
+    };
+
+    /// \brief  Saturated addition
+    static PriorityType Add(PriorityType lhs, PriorityType rhs)
+    {
+        return (lhs == INFINITE_COST || rhs == INFINITE_COST || lhs > INFINITE_COST - rhs)
+               ? INFINITE_COST : static_cast<PriorityType>(lhs + rhs);
+    }
+
+    /// \brief  Estimated distance between two nodes
+    PriorityType Heuristic(std::size_t lhs, std::size_t rhs) const
+    {
+        return HeuristicPolicy::Compute(mp_graph->GetNodeAt(lhs), mp_graph->GetNodeAt(rhs));
+    }
+
+    /// \brief  Computes the key of a node
+    void ComputeKey(std::size_t index, PriorityType& key1, PriorityType& key2) const
+    {
+        const SEntry& entry = m_entries[index];
+
+        key2 = std::min(entry.g, entry.rhs);
+        key1 = Add(Add(key2, Heuristic(m_start, index)), m_km);
+    }
+
+    /// \brief  Queues a node with its current key
+    void Push(std::size_t index)
+    {
+        SEntry& entry = m_entries[index];
+        ComputeKey(index, entry.key1, entry.key2);
+        entry.open = true;
+
+        m_frontier.push_back(SQueued { entry.key1, entry.key2, index });
+        std::push_heap(m_frontier.begin(), m_frontier.end());
+    }
+
+    /// \brief  Drops the stale entries at the top of the frontier
+    void Prune()
+    {
+        while (!m_frontier.empty())
+        {
+            const SQueued& top   = m_frontier.front();
+            const SEntry&  entry = m_entries[top.index];
+
+            if (entry.open && entry.key1 == top.key1 && entry.key2 == top.key2)
+                return;
+
+            std::pop_heap(m_frontier.begin(), m_frontier.end());
+            m_frontier.pop_back();
+        }
+    }
+
+    /// \brief  Recomputes rhs of a node and queues it if inconsistent
+    void UpdateNode(std::size_t index)
+    {
+        SEntry& entry = m_entries[index];
+
+        if (index != m_end)
+        {
+            const TTNode& node = mp_graph->GetNodeAt(index);
+            entry.rhs = INFINITE_COST;
+
+            m_neighbors.clear();
+            mp_graph->GetNeighbors(node, m_neighbors);
+
+            for (const TTNode& next : m_neighbors)
+            {
+                entry.rhs = std::min(entry.rhs, Add(mp_graph->GetCost(node, next), m_entries[mp_graph->GetNodeIndex(next)].g));
+            }
+        }
+
+        entry.open = false;
+        if (entry.g != entry.rhs)
+        {
+            Push(index);
+        }
+    }
+
+    /// \brief  Expands inconsistent nodes until the start node is consistent
+    void ComputeShortestPath()
+    {
+        while (true)
+        {
+            Prune();
+            if (m_frontier.empty())
+                break;
+
+            const SQueued top = m_frontier.front();
+
+            PriorityType start_key1, start_key2;
+            ComputeKey(m_start, start_key1, start_key2);
+
+            const SEntry& start = m_entries[m_start];
+            const bool    below = top.key1 < start_key1 || (top.key1 == start_key1 && top.key2 < start_key2);
+
+            if (!below && start.rhs == start.g)
+                break;
+
+            std::pop_heap(m_frontier.begin(), m_frontier.end());
+            m_frontier.pop_back();
+
+            SEntry& entry = m_entries[top.index];
+            entry.open = false;
+
+            PriorityType key1, key2;
+            ComputeKey(top.index, key1, key2);
+
+            if (top.key1 < key1 || (top.key1 == key1 && top.key2 < key2))
+            {
+                // The key was computed with an older start
+                Push(top.index);
+                continue;
+            }
+
+            if (entry.g > entry.rhs)
+            {
+                entry.g = entry.rhs;
+            }
+            else
+            {
+                entry.g = INFINITE_COST;
+                UpdateNode(top.index);
+            }
+
+            // Moves are symmetric, neighbors are the predecessors
+            m_predecessors.clear();
+            mp_graph->GetNeighbors(mp_graph->GetNodeAt(top.index), m_predecessors);
+
+            for (const TTNode& predecessor : m_predecessors)
+            {
+                UpdateNode(mp_graph->GetNodeIndex(predecessor));
+            }
+        }
+    }
+
+    const Graph*          mp_graph = nullptr; ///< The grid
+    std::size_t           m_start  = 0;       ///< The index of the start node
+    std::size_t           m_last   = 0;       ///< The start node of the last key offset
+    std::size_t           m_end    = 0;       ///< The index of the end node
+    PriorityType          m_km     = 0;       ///< The key offset
+    std::vector<SEntry>   m_entries;          ///< One entry per node
+    std::vector<SQueued>  m_frontier;         ///< The open list
+    std::vector<TTNode>   m_neighbors;        ///< The neighbors scratch buffer
+    std::vector<TTNode>   m_predecessors;     ///< The predecessors of the expanded node
+};
+
+template<typename Graph, typename CoordinateType, typename PriorityType, typename HeuristicPolicy>
+constexpr PriorityType TIncrementalPathfinding<Graph, CoordinateType, PriorityType, HeuristicPolicy>::INFINITE_COST;
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_INCREMENTAL_PATHFINDING_HPP
@@ -0,0 +1,496 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TJumpPointSearch.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_JUMP_POINT_SEARCH_HPP
+#define PATHFINDING_T_JUMP_POINT_SEARCH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+
+#include "TNode.hpp"
+#include "THeuristic.hpp"
+#include "TSearchState.hpp"
+#include "TPathfinding.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TJumpPointRules
+/// \brief  Pruning rules of jump point search on a 4-connected grid
+///
+///         Moving horizontally, the jump stops on a node when one of its
+///         vertical neighbors can't be reached as fast by going through
+///         the parent side (forced neighbor). Moving vertically, the jump
+///         also stops when a horizontal jump from the node finds something.
+///         Rules are expressed on edges, not cells, so they work with
+///         any combination of EFlag connectivity bits.
+///
+/// \tparam Graph The grid class
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+template<typename Graph, typename CoordinateType, typename PriorityType>
+class TJumpPointRules
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  Tells if the edge between (x, y) and (x + dx, y + dy) exists
+    /// \param  graph The grid
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  dx The X direction (-1, 0 or 1)
+    /// \param  dy The Y direction (-1, 0 or 1)
+    /// \return True or false
+    static bool CanMove(const Graph& graph, int x, int y, int dx, int dy)
+    {
+        const int nx = x + dx;
+        const int ny = y + dy;
+
+        if (x  < 0 || x  >= graph.GetWidth() || y  < 0 || y  >= graph.GetHeight() ||
+            nx < 0 || nx >= graph.GetWidth() || ny < 0 || ny >= graph.GetHeight())
+            return false;
+
+        const unsigned char from = graph.GetNode(static_cast<CoordinateType>(x),  static_cast<CoordinateType>(y)) .GetNeighborFlags();
+        const unsigned char to   = graph.GetNode(static_cast<CoordinateType>(nx), static_cast<CoordinateType>(ny)).GetNeighborFlags();
+
+        return (from & GetFlag(dx, dy)) && (to & GetFlag(-dx, -dy));
+    }
+
+    /// \brief  Tells if (x, y), reached horizontally, has a forced neighbor
+    /// \param  graph The grid
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  dx The direction of the move
+    /// \return True or false
+    static bool IsForcedHorizontal(const Graph& graph, int x, int y, int dx)
+    {
+        for (int side = -1; side <= 1; side += 2)
+        {
+            if (CanMove(graph, x, y, 0, side) &&
+              !(CanMove(graph, x - dx, y, 0, side) && CanMove(graph, x - dx, y + side, dx, 0)))
+                return true;
+        }
+
+        return false;
+    }
+
+    /// \brief  Tells if (x, y), reached vertically, has a forced neighbor
+    /// \param  graph The grid
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  dy The direction of the move
+    /// \return True or false
+    static bool IsForcedVertical(const Graph& graph, int x, int y, int dy)
+    {
+        for (int side = -1; side <= 1; side += 2)
+        {
+            if (CanMove(graph, x, y, side, 0) &&
+              !(CanMove(graph, x, y - dy, side, 0) && CanMove(graph, x + side, y - dy, 0, dy)))
+                return true;
+        }
+
+        return false;
+    }
+
+    /// \brief  Returns the neighbor flag of a direction
+    /// \param  dx The X direction
+    /// \param  dy The Y direction
+    /// \return The flag
+    static unsigned char GetFlag(int dx, int dy)
+    {
+        if (dy < 0) return TTNode::NORTH;
+        if (dx > 0) return TTNode::EAST;
+        if (dy > 0) return TTNode::SOUTH;
+        return TTNode::WEST;
+    }
+
+    /// \brief  Returns the direction index used by jump tables
+    ///         0 : North, 1 : East, 2 : South, 3 : West
+    /// \param  dx The X direction
+    /// \param  dy The Y direction
+    /// \return The index
+    static unsigned char GetDirection(int dx, int dy)
+    {
+        if (dy < 0) return 0;
+        if (dx > 0) return 1;
+        if (dy > 0) return 2;
+        return 3;
+    }
+};
+
+/// \class  TJumpPointTable
+/// \brief  JPS+ precomputed jump distances
+///
+///         For each node and each direction, stores the distance to the
+///         next jump point when positive, or minus the number of steps
+///         before hitting an obstacle when negative or null.
+///         Must be rebuilt when the grid connectivity changes.
+///
+/// \tparam Graph The grid class
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+template<typename Graph, typename CoordinateType, typename PriorityType>
+class TJumpPointTable
+{
+public:
+
+    using TTRules = TJumpPointRules<Graph, CoordinateType, PriorityType>;
+
+    /// \brief  Precomputes the jump distances of the whole grid
+    /// \param  graph The grid
+    void Build(const Graph& graph)
+    {
+        const int width  = graph.GetWidth();
+        const int height = graph.GetHeight();
+
+        m_width = width;
+        m_distances.assign(static_cast<std::size_t>(width) * height * 4, 0);
+
+        // Horizontal jumps first, vertical ones depend on them
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = width - 1; x >= 0; --x)
+                Compute(graph, x, y, 1, 0);
+
+            for (int x = 0; x < width; ++x)
+                Compute(graph, x, y, -1, 0);
+        }
+
+        for (int x = 0; x < width; ++x)
+        {
+            for (int y = height - 1; y >= 0; --y)
+                Compute(graph, x, y, 0, 1);
+
+            for (int y = 0; y < height; ++y)
+                Compute(graph, x, y, 0, -1);
+        }
+    }
+
+    /// \brief  Returns the jump distance of a node in a direction
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  direction The direction index (see TJumpPointRules::GetDirection)
+    /// \return The jump distance
+    std::int32_t Get(int x, int y, unsigned char direction) const
+    { return m_distances[(static_cast<std::size_t>(y) * m_width + x) * 4 + direction]; }
+
+private:
+
+    /// \brief  Computes the jump distance of a node, the next node
+    ///         in the direction must already be computed
+    void Compute(const Graph& graph, int x, int y, int dx, int dy)
+    {
+        std::int32_t distance = 0;
+
+        if (TTRules::CanMove(graph, x, y, dx, dy))
+        {
+            const int nx = x + dx;
+            const int ny = y + dy;
+
+            bool jump_point;
+            if (dx != 0)
+            {
+                jump_point = TTRules::IsForcedHorizontal(graph, nx, ny, dx);
+            }
+            else
+            {
+                jump_point = TTRules::IsForcedVertical(graph, nx, ny, dy) ||
+                             Get(nx, ny, TTRules::GetDirection( 1, 0)) > 0 ||
+                             Get(nx, ny, TTRules::GetDirection(-1, 0)) > 0;
+            }
+
+            const std::int32_t next = Get(nx, ny, TTRules::GetDirection(dx, dy));
+
+            if      (jump_point) distance = 1;
+            else if (next > 0)   distance = next + 1;
+            else                 distance = next - 1;
+        }
+
+        m_distances[(static_cast<std::size_t>(y) * m_width + x) * 4 + TTRules::GetDirection(dx, dy)] = distance;
+    }
+
+    int                       m_width = 0; ///< The width of the grid
+    std::vector<std::int32_t> m_distances; ///< 4 distances per node
+};
+
+/// \class  TJumpPointSearch
+/// \brief  Jump point search on uniform-cost 4-connected grids
+///
+///         Returns the same paths as TPathfinding, intermediate
+///         nodes between jump points included, but only expands
+///         jump points. Jumps are either scanned on the grid or read
+///         from a precomputed TJumpPointTable (JPS+).
+///
+///         Nodes must keep the default terrain cost and the grid
+///         must use 4 way moves, the pruning rules rely on both.
+///
+/// \tparam Graph The grid class
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+/// \tparam HeuristicPolicy The heuristic, costed in steps (see THeuristic.hpp)
+template<typename Graph, typename CoordinateType, typename PriorityType,
+         typename HeuristicPolicy = TManhattanHeuristic<CoordinateType, PriorityType>>
+class TJumpPointSearch
+{
+    static_assert(!Graph::TTMoves::DIAGONAL, "Jump point search only supports 4 way grids");
+
+public:
+
+    using TTNode           = TNode           <CoordinateType, PriorityType>;
+    using TTSearchState    = TSearchState    <CoordinateType, PriorityType>;
+    using TTFrontier       = typename TTSearchState::TTFrontier;
+    using TTRules          = TJumpPointRules <Graph, CoordinateType, PriorityType>;
+    using TTJumpPointTable = TJumpPointTable <Graph, CoordinateType, PriorityType>;
+
+    /// \brief  Finds one of the shortest path between start and end node
+    ///         by scanning jumps on the grid
+    /// \param  graph The grid to perform the search on
+    /// \param  state The scratch state of the search, reused between queries
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return true if a path is found
+    static bool GetPath(const Graph& graph, TTSearchState& state, std::vector<TTNode>& path, const TTNode& start, const TTNode& end)
+    {
+        return Search(graph, state, path, start, end,
+            [&graph, &end](int x, int y, int dx, int dy, int& jx, int& jy)
+            { return Jump(graph, x, y, dx, dy, end, jx, jy); });
+    }
+
+    /// \brief  Finds one of the shortest path between start and end node
+    ///         by reading jumps from a precomputed table (JPS+)
+    /// \param  graph The grid to perform the search on
+    /// \param  table The jump distances built from graph
+    /// \param  state The scratch state of the search, reused between queries
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return true if a path is found
+    static bool GetPath(const Graph& graph, const TTJumpPointTable& table, TTSearchState& state, std::vector<TTNode>& path, const TTNode& start, const TTNode& end)
+    {
+        return Search(graph, state, path, start, end,
+            [&table, &end](int x, int y, int dx, int dy, int& jx, int& jy)
+            { return Jump(table, x, y, dx, dy, end, jx, jy); });
+    }
+
+private:
+
+    /// \brief  Scans the grid from (x, y) in a direction until a jump point
+    /// \return True if a jump point (jx, jy) has been found
+    static bool Jump(const Graph& graph, int x, int y, int dx, int dy, const TTNode& end, int& jx, int& jy)
+    {
+        while (TTRules::CanMove(graph, x, y, dx, dy))
+        {
+            x += dx;
+            y += dy;
+
+            bool jump_point = (x == end.X() && y == end.Y());
+
+            if (!jump_point && dx != 0)
+            {
+                jump_point = TTRules::IsForcedHorizontal(graph, x, y, dx);
+            }
+            else if (!jump_point)
+            {
+                int hx, hy;
+                jump_point = TTRules::IsForcedVertical(graph, x, y, dy) ||
+                             Jump(graph, x, y,  1, 0, end, hx, hy) ||
+                             Jump(graph, x, y, -1, 0, end, hx, hy);
+            }
+
+            if (jump_point)
+            {
+                jx = x;
+                jy = y;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// \brief  Reads the jump from (x, y) in a direction in the table
+    ///         The table doesn't know the goal, it is checked here
+    /// \return True if a jump point (jx, jy) has been found
+    static bool Jump(const TTJumpPointTable& table, int x, int y, int dx, int dy, const TTNode& end, int& jx, int& jy)
+    {
+        const std::int32_t distance = table.Get(x, y, TTRules::GetDirection(dx, dy));
+        const std::int32_t reach    = std::abs(distance);
+
+        if (dx != 0)
+        {
+            const int steps = (end.X() - x) * dx;
+            if (end.Y() == y && steps > 0 && steps <= reach)
+            {
+                jx = end.X();
+                jy = end.Y();
+                return true;
+            }
+        }
+        else
+        {
+            // The goal row is a jump point when the goal
+            // can be reached by a horizontal jump from it
+            const int steps = (end.Y() - y) * dy;
+            if (steps > 0 && steps <= reach)
+            {
+                const int offset = end.X() - x;
+                const int side   = (offset > 0) ? 1 : -1;
+
+                if (offset == 0 || std::abs(offset) <= std::abs(table.Get(x, end.Y(), TTRules::GetDirection(side, 0))))
+                {
+                    jx = x;
+                    jy = end.Y();
+                    return true;
+                }
+            }
+        }
+
+        if (distance > 0)
+        {
+            jx = x + dx * distance;
+            jy = y + dy * distance;
+            return true;
+        }
+
+        return false;
+    }
+
+    /// \brief  A* over jump points
+    /// \tparam Jumper Callable (x, y, dx, dy, jx, jy) -> bool
+    template <typename Jumper>
+    static bool Search(const Graph& graph, TTSearchState& state, std::vector<TTNode>& path, const TTNode& start, const TTNode& end, Jumper jumper)
+    {
+        static const int directions[4][2] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 } };
+
+        const HeuristicPolicy heuristic = HeuristicPolicy();
+        bool has_path = false;
+
+        if (!graph.IsReachable(start, end))
+            return false;
+
+        state.BeginQuery(graph.GetNodeCount());
+
+        TTFrontier& frontier = state.GetFrontier();
+
+        const std::size_t start_index = graph.GetNodeIndex(start);
+        const std::size_t end_index   = graph.GetNodeIndex(end);
+
+        // The priority of the given node is unknown,
+        // a large one would be dropped by the stale check
+        TTNode first(start);
+        first.SetPriority(heuristic.Compute(start, end));
+
+        frontier.Push(first);
+        state.Visit(start_index, 0, start_index);
+
+        while (!frontier.IsEmpty())
+        {
+            TTNode current(frontier.Pop());
+
+            const std::size_t current_index = graph.GetNodeIndex(current);
+
+            if (current_index == end_index)
+            {
+                has_path = true;
+                break;
+            }
+
+            const PriorityType current_cost = state.GetCost(current_index);
+
+            if (current.GetPriority() > current_cost + heuristic.Compute(current, end))
+                continue;
+
+            // Direction we came from, the start node has none
+            const TTNode& parent = graph.GetNodeAt(state.GetParent(current_index));
+            const int px = Sign(current.X() - parent.X());
+            const int py = Sign(current.Y() - parent.Y());
+
+            for (const int* direction : directions)
+            {
+                const int dx = direction[0];
+                const int dy = direction[1];
+
+                // Never go back, everything else is either natural or forced
+                if (dx == -px && dy == -py)
+                    continue;
+
+                int jx, jy;
+                if (!jumper(current.X(), current.Y(), dx, dy, jx, jy))
+                    continue;
+
+                TTNode next(graph.GetNode(static_cast<CoordinateType>(jx), static_cast<CoordinateType>(jy)));
+
+                const std::size_t  next_index = graph.GetNodeIndex(next);
+                const PriorityType new_cost   = current_cost + std::abs(jx - current.X()) + std::abs(jy - current.Y());
+
+                if (!state.IsVisited(next_index) || new_cost < state.GetCost(next_index))
+                {
+                    state.Visit(next_index, new_cost, current_index);
+                    next.SetPriority(new_cost + heuristic.Compute(next, end));
+
+                    frontier.Push(next);
+                }
+            }
+        }
+
+        if (has_path)
+        {
+            // Fills the straight segments between jump points
+            std::size_t current = end_index;
+            path.push_back(end);
+            while (current != start_index)
+            {
+                const TTNode& from = graph.GetNodeAt(current);
+                const TTNode& to   = graph.GetNodeAt(state.GetParent(current));
+
+                const int dx = Sign(to.X() - from.X());
+                const int dy = Sign(to.Y() - from.Y());
+
+                int x = from.X();
+                int y = from.Y();
+                while (x != to.X() || y != to.Y())
+                {
+                    x += dx;
+                    y += dy;
+                    path.push_back(graph.GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y)));
+                }
+
+                current = state.GetParent(current);
+            }
+        }
+
+        return has_path;
+    }
+
+    /// \brief  Returns the sign of value (-1, 0 or 1)
+    static int Sign(int value)
+    { return (value > 0) - (value < 0); }
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_JUMP_POINT_SEARCH_HPP
@@ -0,0 +1,221 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TLandmarkTable.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_LANDMARK_TABLE_HPP
+#define PATHFINDING_T_LANDMARK_TABLE_HPP
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+#include "TNode.hpp"
+#include "THeuristic.hpp"
+#include "CWorkStealingPool.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  The version written by TLandmarkTable::Save, bumped on layout changes
+constexpr std::uint32_t LANDMARK_FILE_VERSION = 1;
+
+/// \brief  Leading block of a landmark file
+///
+///         Followed by the X and Y coordinates of the landmarks as 32 bits
+///         pairs, then by the distance table : for each node in row major
+///         order and each landmark, the distance from the landmark and the
+///         distance to the landmark.
+struct SLandmarkFileHeader
+{
+    char          magic[4];       ///< "NAVL"
+    std::uint32_t version;        ///< LANDMARK_FILE_VERSION
+    std::uint32_t width;          ///< The width of the grid
+    std::uint32_t height;         ///< The height of the grid
+    std::uint32_t landmark_count; ///< The number of landmarks
+    std::uint32_t priority_size;  ///< The size of a distance
+    std::uint64_t size;           ///< The size of the file, detects truncation
+};
+
+/// \class  TLandmarkTable
+/// \brief  Exact distances between a few landmarks and all nodes of a grid
+///
+///         By the triangle inequality, d(L, t) - d(L, n) and d(n, L) - d(t, L)
+///         are lower bounds of d(n, t) for any landmark L. The best of them
+///         is a consistent heuristic that sees walls : landmarks behind the
+///         goal make the bound tight along the detour (ALT).
+///
+///         Moves cost the terrain of the entered node, distances are not
+///         symmetric and both directions are stored. The distances of a
+///         node are contiguous, a bound reads two cache lines.
+///
+///         The table keeps the grid epoch it was built at. Once the grid is
+///         edited, the bounds may exceed the true distances and the table
+///         must be built again (see IsValid).
+///
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+template <typename CoordinateType, typename PriorityType>
+class TLandmarkTable
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  The distance of nodes in another component
+    static constexpr PriorityType UNREACHABLE = std::numeric_limits<PriorityType>::max();
+
+    /// \brief  Picks landmarks on the border of a grid and computes their
+    ///         distance tables, one landmark per worker at a time
+    /// \param  graph The graph to build the table on
+    /// \param  count The number of landmarks
+    /// \param  pool The workers
+    template <typename Graph>
+    void Build(const Graph& graph, std::size_t count, CWorkStealingPool& pool);
+
+    /// \brief  Computes the distance tables of given landmarks
+    /// \param  graph The graph to build the table on
+    /// \param  landmarks The landmark nodes
+    /// \param  pool The workers
+    template <typename Graph>
+    void Build(const Graph& graph, const std::vector<TTNode>& landmarks, CWorkStealingPool& pool);
+
+    /// \brief  Writes the table to a file
+    /// \param  path The path of the file
+    /// \return false if the file can't be written
+    bool Save(const char* path) const;
+
+    /// \brief  Reads a table written by Save
+    /// \param  path The path of the file
+    /// \return false if the file can't be read or isn't a valid landmark file,
+    ///         the table is then empty
+    bool Load(const char* path);
+
+    /// \brief  Reads a table written by Save from the current state of a graph
+    /// \param  path The path of the file
+    /// \param  graph The graph the table was built on, unedited since
+    /// \return false if the file can't be read, isn't a valid landmark file
+    ///         or doesn't match the size of the graph
+    template <typename Graph>
+    bool Load(const char* path, const Graph& graph);
+
+    /// \brief  Returns the best lower bound of the distance between two nodes
+    /// \param  from The first node
+    /// \param  to The second node
+    /// \return 0 if no landmark reaches the nodes
+    inline PriorityType GetBound(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Returns the distance from a landmark to a node
+    inline PriorityType GetDistanceFrom(std::size_t landmark, CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns the distance from a node to a landmark
+    inline PriorityType GetDistanceTo(std::size_t landmark, CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns the number of landmarks
+    inline std::size_t GetLandmarkCount() const;
+
+    /// \brief  Returns the X coordinate of a landmark
+    inline CoordinateType GetLandmarkX(std::size_t landmark) const;
+
+    /// \brief  Returns the Y coordinate of a landmark
+    inline CoordinateType GetLandmarkY(std::size_t landmark) const;
+
+    /// \brief  Tells if the table matches the size of a graph
+    template <typename Graph>
+    bool Matches(const Graph& graph) const;
+
+    /// \brief  Tells if the graph was not edited since the table was built
+    template <typename Graph>
+    bool IsValid(const Graph& graph) const;
+
+private:
+
+    /// \brief  Returns the first distance of a node
+    inline std::size_t GetOffset(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Runs a Dijkstra search from a landmark
+    template <typename Graph>
+    static void Integrate(const Graph& graph, const TTNode& landmark, bool reverse,
+                          std::vector<PriorityType>& distances);
+
+    std::size_t                 m_width  = 0;     ///< The width of the grid
+    std::size_t                 m_height = 0;     ///< The height of the grid
+    std::uint32_t               m_epoch  = 0;     ///< The grid epoch of the build
+    bool                        m_bound  = false; ///< True if m_epoch is known
+    std::vector<CoordinateType> m_landmarks;  ///< The X and Y coordinates of the landmarks
+    std::vector<PriorityType>   m_distances;  ///< From and to each landmark, per node
+};
+
+/// \brief  Landmarks heuristic, the best of the table bound
+///         and of a geometric heuristic
+///
+///         Holds the table, the search must be given an instance
+///         (see TPathfinding::GetPath). Default constructed, or once
+///         the grid is edited after the table was built, only the
+///         geometric heuristic is used : a stale table isn't admissible.
+///
+/// \tparam Base The geometric heuristic (see THeuristic.hpp)
+template<typename CoordinateType, typename PriorityType,
+         typename Base = TManhattanHeuristic<CoordinateType, PriorityType>>
+class TLandmarkHeuristic
+{
+public:
+
+    using TTTable = TLandmarkTable<CoordinateType, PriorityType>;
+
+    TLandmarkHeuristic() = default;
+
+    /// \brief  Uses the table of a graph, both must outlive the heuristic
+    template <typename Graph>
+    TLandmarkHeuristic(const TTTable& table, const Graph& graph)
+    : mp_table(&table)
+    , mp_graph(&graph)
+    , mp_is_valid(&IsValid<Graph>)
+    { /* None */ }
+
+    /* inline */ PriorityType Compute(const TNode<CoordinateType, PriorityType>& lhs,
+                                      const TNode<CoordinateType, PriorityType>& rhs) const
+    {
+        const PriorityType base = Base::Compute(lhs, rhs);
+        if (mp_table == nullptr || !mp_is_valid(*mp_table, mp_graph))
+            return base;
+
+        return std::max(base, mp_table->GetBound(lhs, rhs));
+    }
+
+private:
+
+    /// \brief  Tells if the table is still valid for a graph of type Graph
+    template <typename Graph>
+    static bool IsValid(const TTTable& table, const void* graph)
+    { return table.IsValid(*static_cast<const Graph*>(graph)); }
+
+    const TTTable* mp_table    = nullptr; ///< The landmarks
+    const void*    mp_graph    = nullptr; ///< The graph of the table
+    bool        (* mp_is_valid)(const TTTable&, const void*) = nullptr; ///< Checks the epoch of the graph
+};
+
+} // !namespace nav
+
+#include "TLandmarkTable.inl"
+
+#endif // PATHFINDING_T_LANDMARK_TABLE_HPP
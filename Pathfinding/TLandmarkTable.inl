@@ -0,0 +1,375 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TLandmarkTable.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include "TFrontier.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+template <typename CoordinateType, typename PriorityType>
+constexpr PriorityType TLandmarkTable<CoordinateType, PriorityType>::UNREACHABLE;
+
+/// \brief  Picks landmarks on the border of a grid and computes their
+///         distance tables, one landmark per worker at a time
+///
+///         The grid is cut in count angular sectors around its center,
+///         the landmark of a sector is its open node farthest from the
+///         center. Sectors are scanned in parallel.
+///
+/// \param  graph The graph to build the table on
+/// \param  count The number of landmarks
+/// \param  pool The workers
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+void TLandmarkTable<CoordinateType, PriorityType>::Build(const Graph& graph, std::size_t count, CWorkStealingPool& pool)
+{
+    const double pi       = 3.14159265358979323846;
+    const double center_x = (graph.GetWidth()  - 1) * 0.5;
+    const double center_y = (graph.GetHeight() - 1) * 0.5;
+
+    std::vector<TTNode> candidates(count);
+    std::vector<char>   found(count, 0);
+
+    pool.ParallelFor(count, 1, [&](std::size_t /* worker */, std::size_t begin, std::size_t end)
+    {
+        std::vector<TTNode> neighbors;
+
+        for (std::size_t sector = begin; sector < end; ++sector)
+        {
+            double best = -1.0;
+
+            for (CoordinateType y = 0; y < graph.GetHeight(); ++y)
+            {
+                for (CoordinateType x = 0; x < graph.GetWidth(); ++x)
+                {
+                    const double dx    = x - center_x;
+                    const double dy    = y - center_y;
+                    const double angle = std::atan2(dy, dx) + pi;
+                    const auto   slice = std::min(count - 1, static_cast<std::size_t>(angle / (2.0 * pi) * count));
+                    const double reach = dx * dx + dy * dy;
+
+                    if (slice != sector || reach <= best)
+                        continue;
+
+                    // Isolated nodes would give empty tables
+                    const TTNode node = graph.GetNode(x, y);
+                    neighbors.clear();
+                    graph.GetNeighbors(node, neighbors);
+
+                    if (neighbors.empty())
+                        continue;
+
+                    best               = reach;
+                    candidates[sector] = node;
+                    found[sector]      = 1;
+                }
+            }
+        }
+    });
+
+    std::vector<TTNode> landmarks;
+    for (std::size_t sector = 0; sector < count; ++sector)
+    {
+        if (found[sector])
+            landmarks.push_back(candidates[sector]);
+    }
+
+    Build(graph, landmarks, pool);
+}
+
+/// \brief  Computes the distance tables of given landmarks
+/// \param  graph The graph to build the table on
+/// \param  landmarks The landmark nodes
+/// \param  pool The workers
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+void TLandmarkTable<CoordinateType, PriorityType>::Build(const Graph& graph, const std::vector<TTNode>& landmarks, CWorkStealingPool& pool)
+{
+    const std::size_t count = landmarks.size();
+
+    m_width  = static_cast<std::size_t>(graph.GetWidth());
+    m_height = static_cast<std::size_t>(graph.GetHeight());
+    m_epoch  = graph.GetEpoch();
+    m_bound  = true;
+    m_landmarks.clear();
+    m_distances.assign(m_width * m_height * count * 2, UNREACHABLE);
+
+    for (const TTNode& landmark : landmarks)
+    {
+        m_landmarks.push_back(landmark.X());
+        m_landmarks.push_back(landmark.Y());
+    }
+
+    // Each worker writes the slots of its own landmarks only
+    pool.ParallelFor(count, 1, [&](std::size_t /* worker */, std::size_t begin, std::size_t end)
+    {
+        std::vector<PriorityType> distances;
+
+        for (std::size_t landmark = begin; landmark < end; ++landmark)
+        {
+            for (std::size_t direction = 0; direction < 2; ++direction)
+            {
+                Integrate(graph, landmarks[landmark], direction == 1, distances);
+
+                for (std::size_t y = 0; y < m_height; ++y)
+                {
+                    for (std::size_t x = 0; x < m_width; ++x)
+                    {
+                        const TTNode node = graph.GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y));
+                        m_distances[(y * m_width + x) * count * 2 + landmark * 2 + direction] = distances[graph.GetNodeIndex(node)];
+                    }
+                }
+            }
+        }
+    });
+}
+
+/// \brief  Writes the table to a file
+/// \param  path The path of the file
+/// \return false if the file can't be written
+template <typename CoordinateType, typename PriorityType>
+bool TLandmarkTable<CoordinateType, PriorityType>::Save(const char* path) const
+{
+    std::vector<std::uint32_t> landmarks(m_landmarks.begin(), m_landmarks.end());
+
+    SLandmarkFileHeader header;
+    std::memcpy(header.magic, "NAVL", 4);
+    header.version        = LANDMARK_FILE_VERSION;
+    header.width          = static_cast<std::uint32_t>(m_width);
+    header.height         = static_cast<std::uint32_t>(m_height);
+    header.landmark_count = static_cast<std::uint32_t>(GetLandmarkCount());
+    header.priority_size  = sizeof(PriorityType);
+    header.size           = sizeof(header) + landmarks.size() * sizeof(std::uint32_t) + m_distances.size() * sizeof(PriorityType);
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && std::fwrite(landmarks.data(),   sizeof(std::uint32_t), landmarks.size(),   file) == landmarks.size();
+    ok = ok && std::fwrite(m_distances.data(), sizeof(PriorityType),  m_distances.size(), file) == m_distances.size();
+
+    return std::fclose(file) == 0 && ok;
+}
+
+/// \brief  Reads a table written by Save
+/// \param  path The path of the file
+/// \return false if the file can't be read or isn't a valid landmark file,
+///         the table is then empty
+template <typename CoordinateType, typename PriorityType>
+bool TLandmarkTable<CoordinateType, PriorityType>::Load(const char* path)
+{
+    m_width  = 0;
+    m_height = 0;
+    m_bound  = false;
+    m_landmarks.clear();
+    m_distances.clear();
+
+    // The file doesn't know the epoch of the grid,
+    // it is bound by the Load overload taking the graph
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+        return false;
+
+    SLandmarkFileHeader header;
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+           && std::memcmp(header.magic, "NAVL", 4) == 0
+           && header.version       == LANDMARK_FILE_VERSION
+           && header.priority_size == sizeof(PriorityType)
+           && header.width         <= static_cast<std::uint64_t>(std::numeric_limits<CoordinateType>::max())
+           && header.height        <= static_cast<std::uint64_t>(std::numeric_limits<CoordinateType>::max());
+
+    const std::uint64_t landmark_count = ok ? header.landmark_count : 0;
+    const std::uint64_t node_count     = ok ? static_cast<std::uint64_t>(header.width) * header.height : 0;
+
+    ok = ok && header.size == sizeof(header) + landmark_count * 2 * sizeof(std::uint32_t)
+                                             + node_count * landmark_count * 2 * sizeof(PriorityType);
+
+    std::vector<std::uint32_t> landmarks;
+    if (ok)
+    {
+        landmarks.resize(static_cast<std::size_t>(landmark_count * 2));
+        m_distances.resize(static_cast<std::size_t>(node_count * landmark_count * 2));
+
+        ok = std::fread(landmarks.data(),   sizeof(std::uint32_t), landmarks.size(),   file) == landmarks.size()
+          && std::fread(m_distances.data(), sizeof(PriorityType),  m_distances.size(), file) == m_distances.size();
+    }
+
+    // Landmarks must lie on the grid
+    for (std::size_t n = 0; ok && n < landmarks.size(); n += 2)
+        ok = landmarks[n] < header.width && landmarks[n + 1] < header.height;
+
+    std::fclose(file);
+
+    if (!ok)
+    {
+        m_distances.clear();
+        return false;
+    }
+
+    m_width  = header.width;
+    m_height = header.height;
+    m_landmarks.assign(landmarks.begin(), landmarks.end());
+    return true;
+}
+
+/// \brief  Reads a table written by Save from the current state of a graph
+/// \param  path The path of the file
+/// \param  graph The graph the table was built on, unedited since
+/// \return false if the file can't be read, isn't a valid landmark file
+///         or doesn't match the size of the graph
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+bool TLandmarkTable<CoordinateType, PriorityType>::Load(const char* path, const Graph& graph)
+{
+    if (!Load(path) || !Matches(graph))
+        return false;
+
+    m_epoch = graph.GetEpoch();
+    m_bound = true;
+    return true;
+}
+
+/// \brief  Returns the best lower bound of the distance between two nodes
+///         Landmarks in another component than one of the nodes are skipped
+/// \param  from The first node
+/// \param  to The second node
+/// \return 0 if no landmark reaches the nodes
+template <typename CoordinateType, typename PriorityType>
+inline PriorityType TLandmarkTable<CoordinateType, PriorityType>::GetBound(const TTNode& from, const TTNode& to) const
+{
+    const std::size_t   count = GetLandmarkCount();
+    const PriorityType* lhs   = m_distances.data() + GetOffset(from.X(), from.Y());
+    const PriorityType* rhs   = m_distances.data() + GetOffset(to.X(), to.Y());
+
+    PriorityType bound = 0;
+    for (std::size_t n = 0; n < count * 2; n += 2)
+    {
+        if (lhs[n] == UNREACHABLE || rhs[n] == UNREACHABLE)
+            continue;
+
+        // d(L, to) <= d(L, from) + d(from, to) and d(from, L) <= d(from, to) + d(to, L)
+        bound = std::max(bound, static_cast<PriorityType>(rhs[n]     - lhs[n]));
+        bound = std::max(bound, static_cast<PriorityType>(lhs[n + 1] - rhs[n + 1]));
+    }
+
+    return bound;
+}
+
+template <typename CoordinateType, typename PriorityType>
+inline PriorityType TLandmarkTable<CoordinateType, PriorityType>::GetDistanceFrom(std::size_t landmark, CoordinateType x, CoordinateType y) const
+{ return m_distances[GetOffset(x, y) + landmark * 2]; }
+
+template <typename CoordinateType, typename PriorityType>
+inline PriorityType TLandmarkTable<CoordinateType, PriorityType>::GetDistanceTo(std::size_t landmark, CoordinateType x, CoordinateType y) const
+{ return m_distances[GetOffset(x, y) + landmark * 2 + 1]; }
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t TLandmarkTable<CoordinateType, PriorityType>::GetLandmarkCount() const
+{ return m_landmarks.size() / 2; }
+
+template <typename CoordinateType, typename PriorityType>
+inline CoordinateType TLandmarkTable<CoordinateType, PriorityType>::GetLandmarkX(std::size_t landmark) const
+{ return m_landmarks[landmark * 2]; }
+
+template <typename CoordinateType, typename PriorityType>
+inline CoordinateType TLandmarkTable<CoordinateType, PriorityType>::GetLandmarkY(std::size_t landmark) const
+{ return m_landmarks[landmark * 2 + 1]; }
+
+/// \brief  Tells if the table matches the size of a graph
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+bool TLandmarkTable<CoordinateType, PriorityType>::Matches(const Graph& graph) const
+{
+    return m_width  == static_cast<std::size_t>(graph.GetWidth())
+        && m_height == static_cast<std::size_t>(graph.GetHeight());
+}
+
+/// \brief  Tells if the graph was not edited since the table was built
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+bool TLandmarkTable<CoordinateType, PriorityType>::IsValid(const Graph& graph) const
+{
+    return m_bound && graph.GetEpoch() == m_epoch && Matches(graph);
+}
+
+template <typename CoordinateType, typename PriorityType>
+inline std::size_t TLandmarkTable<CoordinateType, PriorityType>::GetOffset(CoordinateType x, CoordinateType y) const
+{ return (static_cast<std::size_t>(y) * m_width + x) * GetLandmarkCount() * 2; }
+
+/// \brief  Runs a Dijkstra search from a landmark
+/// \param  graph The graph to search
+/// \param  landmark The start node
+/// \param  reverse Computes the distances to the landmark instead of from it
+/// \param  distances The distances, indexed by node (see Graph::GetNodeIndex)
+template <typename CoordinateType, typename PriorityType>
+template <typename Graph>
+void TLandmarkTable<CoordinateType, PriorityType>::Integrate(const Graph& graph, const TTNode& landmark, bool reverse,
+                                                             std::vector<PriorityType>& distances)
+{
+    TDefaultFrontier<CoordinateType, PriorityType> frontier;
+    std::vector<TTNode>                            neighbors;
+
+    distances.assign(graph.GetNodeCount(), UNREACHABLE);
+
+    TTNode start(landmark);
+    start.SetPriority(0);
+    frontier.Push(start);
+    distances[graph.GetNodeIndex(landmark)] = 0;
+
+    while (!frontier.IsEmpty())
+    {
+        const TTNode      current(frontier.Pop());
+        const std::size_t current_index = graph.GetNodeIndex(current);
+
+        // Pushed again with a better distance since this entry was queued
+        if (current.GetPriority() > distances[current_index])
+            continue;
+
+        neighbors.clear();
+        graph.GetNeighbors(current, neighbors);
+
+        for (TTNode& next : neighbors)
+        {
+            // Moves are symmetric, only their cost depends on the direction
+            const std::size_t  next_index = graph.GetNodeIndex(next);
+            const PriorityType move       = reverse ? graph.GetCost(next, current) : graph.GetCost(current, next);
+            const PriorityType distance   = distances[current_index] + move;
+
+            if (distance < distances[next_index])
+            {
+                distances[next_index] = distance;
+
+                next.SetPriority(distance);
+                frontier.Push(next);
+            }
+        }
+    }
+}
+
+} // !namespace nav
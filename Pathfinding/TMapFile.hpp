@@ -0,0 +1,404 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TMapFile.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_MAP_FILE_HPP
+#define PATHFINDING_T_MAP_FILE_HPP
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "TNode.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  The version written by SaveMapFile, bumped on layout changes
+constexpr std::uint32_t MAP_FILE_VERSION = 1;
+
+/// \brief  The alignment of the sections of a map file
+constexpr std::uint64_t MAP_FILE_ALIGNMENT = 64;
+
+/// \brief  Leading block of a binary map file
+///
+///         Sections are raw arrays in row major order, at aligned
+///         offsets so that they can be used in place once mapped.
+///         Numbers are stored in the byte order of the writer.
+struct SMapFileHeader
+{
+    char          magic[4];          ///< "NAVG"
+    std::uint32_t version;           ///< MAP_FILE_VERSION
+    std::uint32_t width;             ///< The width of the grid
+    std::uint32_t height;            ///< The height of the grid
+    std::uint64_t flags_offset;      ///< One neighbor flags byte per node
+    std::uint64_t costs_offset;      ///< One terrain cost byte per node
+    std::uint64_t components_offset; ///< One 32 bits component label per node
+    std::uint64_t size;              ///< The size of the file, detects truncation
+};
+
+/// \brief  Leading block of a chunked map file
+///
+///         The grid is cut in square chunks of chunk_size nodes, stored
+///         one after the other in row major order. A chunk holds its
+///         neighbor flags, terrain costs, then 32 bits component labels
+///         at a 4 bytes aligned offset, all in row major order. Nodes of
+///         the chunks crossing the grid border are padded as blocked.
+struct SChunkedMapFileHeader
+{
+    char          magic[4];    ///< "NAVC"
+    std::uint32_t version;     ///< MAP_FILE_VERSION
+    std::uint32_t width;       ///< The width of the grid
+    std::uint32_t height;      ///< The height of the grid
+    std::uint32_t chunk_size;  ///< The width and height of a chunk
+    std::uint32_t chunks_x;    ///< The number of chunks on X
+    std::uint32_t chunks_y;    ///< The number of chunks on Y
+    std::uint32_t padding;     ///< Unused, zero
+    std::uint64_t chunk_bytes; ///< The size of a chunk
+    std::uint64_t data_offset; ///< The offset of the first chunk
+    std::uint64_t size;        ///< The size of the file, detects truncation
+};
+
+/// \brief  Returns the offset of the component labels inside a chunk
+/// \param  chunkSize The width and height of a chunk
+/// \return The offset in bytes
+inline std::uint64_t GetChunkComponentsOffset(std::uint32_t chunkSize)
+{
+    const std::uint64_t count = static_cast<std::uint64_t>(chunkSize) * chunkSize;
+    return (2 * count + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t) * sizeof(std::uint32_t);
+}
+
+/// \brief  Fills a grid from a text map
+///
+///         Reads the MovingAI format (type / height / width / map
+///         lines, then one line per row) or bare rows if there is no
+///         header. '.', 'G' and 'S' are open, any other character is
+///         blocked. Open nodes are linked in all the directions the
+///         grid moves allow.
+///
+/// \param  path The path of the text file
+/// \param  grid The grid to initialize
+/// \return false if the file can't be read or rows have different widths
+template <typename Grid>
+bool ImportTextMap(const char* path, Grid& grid)
+{
+    using TTNode = typename Grid::TTNode;
+
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    std::vector<std::string> rows;
+    std::string line;
+    bool in_header = true;
+
+    while (std::getline(file, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        if (in_header)
+        {
+            if (line == "map")
+            {
+                in_header = false;
+                continue;
+            }
+
+            // No header, the first line is already a row
+            if (line.compare(0, 4, "type") != 0 && line.compare(0, 6, "height") != 0 && line.compare(0, 5, "width") != 0)
+                in_header = false;
+            else
+                continue;
+        }
+
+        if (!line.empty())
+            rows.push_back(line);
+    }
+
+    if (rows.empty())
+        return false;
+
+    const std::size_t width = rows.front().size();
+    for (const std::string& row : rows)
+    {
+        if (row.size() != width)
+            return false;
+    }
+
+    const unsigned char open = Grid::TTMoves::DIAGONAL ? (TTNode::ALL | TTNode::DIAGONALS) : TTNode::ALL;
+
+    grid.Initialize(static_cast<decltype(grid.GetWidth())>(width), static_cast<decltype(grid.GetWidth())>(rows.size()));
+    for (std::size_t y = 0; y < rows.size(); ++y)
+    {
+        for (std::size_t x = 0; x < width; ++x)
+        {
+            const char cell = rows[y][x];
+            if (cell == '.' || cell == 'G' || cell == 'S')
+                grid.SetNodeNeighbors(static_cast<decltype(grid.GetWidth())>(x), static_cast<decltype(grid.GetWidth())>(y), open);
+        }
+    }
+
+    return true;
+}
+
+/// \brief  Writes a grid, its terrain costs and its components to a binary map file
+/// \param  path The path of the file
+/// \param  grid The grid to save
+/// \return false if the file can't be written
+template <typename Grid>
+bool SaveMapFile(const char* path, const Grid& grid)
+{
+    // Grids with a padded layout have more nodes, the file is always row major
+    const std::uint64_t count   = static_cast<std::uint64_t>(grid.GetWidth()) * grid.GetHeight();
+    auto                aligned = [](std::uint64_t offset) { return (offset + MAP_FILE_ALIGNMENT - 1) / MAP_FILE_ALIGNMENT * MAP_FILE_ALIGNMENT; };
+
+    SMapFileHeader header;
+    std::memcpy(header.magic, "NAVG", 4);
+    header.version           = MAP_FILE_VERSION;
+    header.width             = static_cast<std::uint32_t>(grid.GetWidth());
+    header.height            = static_cast<std::uint32_t>(grid.GetHeight());
+    header.flags_offset      = aligned(sizeof(SMapFileHeader));
+    header.costs_offset      = aligned(header.flags_offset + count);
+    header.components_offset = aligned(header.costs_offset + count);
+    header.size              = header.components_offset + count * sizeof(std::uint32_t);
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    using TTCoordinate = decltype(grid.GetWidth());
+
+    // Sections are written one row at a time, the file is never held in memory
+    const std::size_t          width  = grid.GetWidth();
+    const std::size_t          height = grid.GetHeight();
+    std::vector<unsigned char> row(width * sizeof(std::uint32_t));
+    std::uint64_t              written = 0;
+    bool                       ok      = true;
+
+    auto write = [&](const void* data, std::size_t size)
+    {
+        ok       = ok && std::fwrite(data, 1, size, file) == size;
+        written += size;
+    };
+
+    auto pad = [&](std::uint64_t offset)
+    {
+        static const unsigned char zeros[MAP_FILE_ALIGNMENT] = {};
+        write(zeros, static_cast<std::size_t>(offset - written));
+    };
+
+    write(&header, sizeof(header));
+
+    pad(header.flags_offset);
+    for (std::size_t y = 0; y < height; ++y)
+    {
+        for (std::size_t x = 0; x < width; ++x)
+            row[x] = grid.GetNode(static_cast<TTCoordinate>(x), static_cast<TTCoordinate>(y)).GetNeighborFlags();
+
+        write(row.data(), width);
+    }
+
+    pad(header.costs_offset);
+    for (std::size_t y = 0; y < height; ++y)
+    {
+        for (std::size_t x = 0; x < width; ++x)
+            row[x] = grid.GetNodeCost(static_cast<TTCoordinate>(x), static_cast<TTCoordinate>(y));
+
+        write(row.data(), width);
+    }
+
+    pad(header.components_offset);
+    for (std::size_t y = 0; y < height; ++y)
+    {
+        for (std::size_t x = 0; x < width; ++x)
+        {
+            const std::uint32_t component = grid.GetComponent(static_cast<TTCoordinate>(x), static_cast<TTCoordinate>(y));
+            std::memcpy(row.data() + x * sizeof(std::uint32_t), &component, sizeof(component));
+        }
+
+        write(row.data(), width * sizeof(std::uint32_t));
+    }
+
+    return std::fclose(file) == 0 && ok;
+}
+
+/// \brief  Writes a grid, its terrain costs and its components to a chunked map file
+/// \param  path The path of the file
+/// \param  grid The grid to save
+/// \param  chunkSize The width and height of a chunk
+/// \return false if the file can't be written
+template <typename Grid>
+bool SaveChunkedMapFile(const char* path, const Grid& grid, std::uint32_t chunkSize)
+{
+    using TTCoordinate = decltype(grid.GetWidth());
+
+    const std::uint64_t count = static_cast<std::uint64_t>(chunkSize) * chunkSize;
+
+    SChunkedMapFileHeader header;
+    std::memcpy(header.magic, "NAVC", 4);
+    header.version     = MAP_FILE_VERSION;
+    header.width       = static_cast<std::uint32_t>(grid.GetWidth());
+    header.height      = static_cast<std::uint32_t>(grid.GetHeight());
+    header.chunk_size  = chunkSize;
+    header.chunks_x    = (header.width  + chunkSize - 1) / chunkSize;
+    header.chunks_y    = (header.height + chunkSize - 1) / chunkSize;
+    header.padding     = 0;
+    header.chunk_bytes = GetChunkComponentsOffset(chunkSize) + count * sizeof(std::uint32_t);
+    header.data_offset = (sizeof(header) + MAP_FILE_ALIGNMENT - 1) / MAP_FILE_ALIGNMENT * MAP_FILE_ALIGNMENT;
+    header.size        = header.data_offset + header.chunk_bytes * header.chunks_x * header.chunks_y;
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    static const unsigned char zeros[MAP_FILE_ALIGNMENT] = {};
+
+    bool ok = std::fwrite(&header, 1, sizeof(header), file) == sizeof(header);
+    ok = ok && std::fwrite(zeros, 1, static_cast<std::size_t>(header.data_offset - sizeof(header)), file) == header.data_offset - sizeof(header);
+
+    // One chunk in memory at a time
+    std::vector<unsigned char> chunk(static_cast<std::size_t>(header.chunk_bytes));
+    unsigned char* flags      = chunk.data();
+    unsigned char* costs      = chunk.data() + count;
+    unsigned char* components = chunk.data() + GetChunkComponentsOffset(chunkSize);
+
+    for (std::uint32_t cy = 0; ok && cy < header.chunks_y; ++cy)
+    {
+        for (std::uint32_t cx = 0; ok && cx < header.chunks_x; ++cx)
+        {
+            for (std::uint32_t ly = 0; ly < chunkSize; ++ly)
+            {
+                for (std::uint32_t lx = 0; lx < chunkSize; ++lx)
+                {
+                    const std::size_t   local     = static_cast<std::size_t>(ly) * chunkSize + lx;
+                    const std::uint32_t x         = cx * chunkSize + lx;
+                    const std::uint32_t y         = cy * chunkSize + ly;
+                    std::uint32_t       component = UINT32_MAX;
+
+                    flags[local] = 0;
+                    costs[local] = 1;
+
+                    if (x < header.width && y < header.height)
+                    {
+                        const auto& node = grid.GetNode(static_cast<TTCoordinate>(x), static_cast<TTCoordinate>(y));
+                        flags[local] = node.GetNeighborFlags();
+                        costs[local] = grid.GetNodeCost(node.X(), node.Y());
+                        component    = grid.GetComponent(node.X(), node.Y());
+                    }
+
+                    std::memcpy(components + local * sizeof(std::uint32_t), &component, sizeof(component));
+                }
+            }
+
+            ok = std::fwrite(chunk.data(), 1, chunk.size(), file) == chunk.size();
+        }
+    }
+
+    return std::fclose(file) == 0 && ok;
+}
+
+/// \brief  A query of a scenario file
+struct SScenarioQuery
+{
+    std::uint32_t bucket  = 0;   ///< The group of the query, by optimal length
+    std::string   map;           ///< The name of the map file
+    std::uint32_t width   = 0;   ///< The width of the map
+    std::uint32_t height  = 0;   ///< The height of the map
+    std::uint32_t start_x = 0;   ///< The X coordinate of the start node
+    std::uint32_t start_y = 0;   ///< The Y coordinate of the start node
+    std::uint32_t goal_x  = 0;   ///< The X coordinate of the goal node
+    std::uint32_t goal_y  = 0;   ///< The Y coordinate of the goal node
+    double        optimal = 0.0; ///< The optimal path length
+};
+
+/// \brief  Reads a scenario file
+///
+///         MovingAI format : a "version 1" line, then one query per
+///         line, bucket map width height start_x start_y goal_x goal_y
+///         optimal, separated by tabs. Optimal lengths are for 8 way
+///         moves, sqrt(2) per diagonal, corners can't be cut.
+///
+/// \param  path The path of the scenario file
+/// \param  queries The vector to append the queries to
+/// \return false if the file can't be read or a line is malformed
+inline bool LoadScenarioFile(const char* path, std::vector<SScenarioQuery>& queries)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        if (line.empty() || line.compare(0, 7, "version") == 0)
+            continue;
+
+        SScenarioQuery     query;
+        std::istringstream fields(line);
+
+        if (!(fields >> query.bucket >> query.map >> query.width >> query.height
+                     >> query.start_x >> query.start_y >> query.goal_x >> query.goal_y >> query.optimal))
+            return false;
+
+        queries.push_back(query);
+    }
+
+    return true;
+}
+
+/// \brief  Writes a scenario file (see LoadScenarioFile)
+/// \param  path The path of the scenario file
+/// \param  queries The queries to write
+/// \return false if the file can't be written
+inline bool SaveScenarioFile(const char* path, const std::vector<SScenarioQuery>& queries)
+{
+    std::ofstream file(path);
+    if (!file)
+        return false;
+
+    file << "version 1\n";
+    file.precision(8);
+
+    for (const SScenarioQuery& query : queries)
+    {
+        file << query.bucket  << '\t' << query.map     << '\t'
+             << query.width   << '\t' << query.height  << '\t'
+             << query.start_x << '\t' << query.start_y << '\t'
+             << query.goal_x  << '\t' << query.goal_y  << '\t'
+             << std::fixed    << query.optimal << '\n';
+    }
+
+    return static_cast<bool>(file);
+}
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_MAP_FILE_HPP
@@ -0,0 +1,131 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TMappedGrid.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_MAPPED_GRID_HPP
+#define PATHFINDING_T_MAPPED_GRID_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+#include "TNode.hpp"
+#include "TMapFile.hpp"
+#include "CMappedFile.hpp"
+#include "TMoveRules.hpp"
+#include "TMovePolicy.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TMappedGrid
+/// \brief  Read only grid used in place from a mapped binary map file
+///
+///         Opening only checks the header, nodes are never constructed :
+///         they are built on the fly from the flags, so nodes are
+///         returned by value. Components and costs come precomputed
+///         from the file (see SaveMapFile).
+///
+/// \tparam CoordinateType The type of the coordinate system
+/// \tparam PriorityType   The type of the priority
+/// \tparam Moves          The move policy (see TMovePolicy.hpp)
+template <typename CoordinateType, typename PriorityType, typename Moves = TFourWayMoves<PriorityType>>
+class TMappedGrid
+{
+public:
+
+    using TTNode  = TNode<CoordinateType, PriorityType>;
+    using TTMoves = Moves;
+
+    /// \brief  Maps a binary map file
+    /// \param  path The path of the file
+    /// \return false if the file can't be mapped or isn't a valid map file
+    bool Open(const char* path);
+
+    /// \brief  Puts into the current node neighbors all direct neighbors,
+    ///         followed by the diagonal ones if the move policy allows them
+    /// \param  current The node to check
+    /// \param  neighbors The vector of neighbors
+    inline void GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const;
+
+    /// \brief  Returns the cost to move from a node to one of its neighbors
+    /// \param  from The current node
+    /// \param  to The neighbor
+    /// \return The cost of the move
+    inline PriorityType GetCost(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Returns the terrain cost of a node
+    inline unsigned char GetNodeCost(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \return A node
+    inline TTNode GetNode(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns a node from its index
+    /// \param  index The index of the node (see GetNodeIndex)
+    /// \return A node
+    inline TTNode GetNodeAt(std::size_t index) const;
+
+    /// \brief  Returns the index of a node in the grid (y * width + x)
+    inline std::size_t GetNodeIndex(const TTNode& node) const;
+
+    /// \brief  Returns the number of nodes of the grid
+    inline std::size_t GetNodeCount() const;
+
+    /// \brief  Returns the width of the grid
+    inline CoordinateType GetWidth() const;
+
+    /// \brief  Returns the height of the grid
+    inline CoordinateType GetHeight() const;
+
+    /// \brief  Tells if two nodes are in the same connected component
+    inline bool IsReachable(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Returns the connected component label of a node
+    inline std::uint32_t GetComponent(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  The grid is read only, the epochs never change
+    inline std::uint32_t GetEpoch() const;
+    inline std::uint32_t GetNodeEpoch(std::size_t index) const;
+
+    /// \brief  Tells if the node is valid or node
+    inline bool IsValidNode(CoordinateType x, CoordinateType y) const;
+
+private:
+
+    using TTMoveRules = TMoveRules<TTNode, Moves>;
+
+    CMappedFile          m_file;                   ///< The mapping
+    CoordinateType       m_width       = 0;        ///< The width of the grid
+    CoordinateType       m_height      = 0;        ///< The height of the grid
+    const unsigned char* mp_flags      = nullptr;  ///< The neighbor flags of each node
+    const unsigned char* mp_costs      = nullptr;  ///< The terrain cost of each node
+    const std::uint32_t* mp_components = nullptr;  ///< The component label of each node
+};
+
+} // !namespace nav
+
+#include "TMappedGrid.inl"
+
+#endif // PATHFINDING_T_MAPPED_GRID_HPP
@@ -0,0 +1,154 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TMappedGrid.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <limits>
+#include <cstring>
+#include <algorithm>
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  Maps a binary map file
+/// \param  path The path of the file
+/// \return false if the file can't be mapped or isn't a valid map file
+template <typename CoordinateType, typename PriorityType, typename Moves>
+bool TMappedGrid<CoordinateType, PriorityType, Moves>::Open(const char* path)
+{
+    mp_flags      = nullptr;
+    mp_costs      = nullptr;
+    mp_components = nullptr;
+
+    if (!m_file.Open(path) || m_file.GetSize() < sizeof(SMapFileHeader))
+        return false;
+
+    SMapFileHeader header;
+    std::memcpy(&header, m_file.GetData(), sizeof(header));
+
+    const std::uint64_t count = static_cast<std::uint64_t>(header.width) * header.height;
+    const bool valid = std::memcmp(header.magic, "NAVG", 4) == 0
+                    && header.version == MAP_FILE_VERSION
+                    && header.size    == m_file.GetSize()
+                    && header.width   <= static_cast<std::uint64_t>(std::numeric_limits<CoordinateType>::max())
+                    && header.height  <= static_cast<std::uint64_t>(std::numeric_limits<CoordinateType>::max())
+                    && header.flags_offset + count <= header.size
+                    && header.costs_offset + count <= header.size
+                    && header.components_offset % alignof(std::uint32_t) == 0
+                    && header.components_offset + count * sizeof(std::uint32_t) <= header.size;
+
+    if (!valid)
+    {
+        m_file.Close();
+        return false;
+    }
+
+    m_width       = static_cast<CoordinateType>(header.width);
+    m_height      = static_cast<CoordinateType>(header.height);
+    mp_flags      = m_file.GetData() + header.flags_offset;
+    mp_costs      = m_file.GetData() + header.costs_offset;
+    mp_components = reinterpret_cast<const std::uint32_t*>(m_file.GetData() + header.components_offset);
+    return true;
+}
+
+/// \brief  Puts into the current node neighbors all direct neighbors,
+///         followed by the diagonal ones if the move policy allows them
+/// \param  current The node to check
+/// \param  neighbors The vector of neighbors
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline void TMappedGrid<CoordinateType, PriorityType, Moves>::GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const
+{
+    TTMoveRules::GetNeighbors(current.X(), current.Y(), mp_flags[GetNodeIndex(current)],
+        [this](int x, int y) -> unsigned char
+        { return IsValidNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y)) ? mp_flags[static_cast<std::size_t>(y) * m_width + x] : 0; },
+        [this](int x, int y, unsigned char /* flags */)
+        { return GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y)); },
+        neighbors);
+}
+
+/// \brief  Returns the cost to move from a node to one of its neighbors
+///         The terrain cost of the neighbor scaled by the move length
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline PriorityType TMappedGrid<CoordinateType, PriorityType, Moves>::GetCost(const TTNode& from, const TTNode& to) const
+{
+    const PriorityType cost = mp_costs[GetNodeIndex(to)];
+
+    if (Moves::DIAGONAL && from.X() != to.X() && from.Y() != to.Y())
+        return cost * Moves::DIAGONAL_COST;
+
+    return cost * Moves::STRAIGHT_COST;
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline unsigned char TMappedGrid<CoordinateType, PriorityType, Moves>::GetNodeCost(CoordinateType x, CoordinateType y) const
+{ return mp_costs[static_cast<std::size_t>(y) * m_width + x]; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline TNode<CoordinateType, PriorityType> TMappedGrid<CoordinateType, PriorityType, Moves>::GetNode(CoordinateType x, CoordinateType y) const
+{
+    TTNode node(x, y);
+    node.SetNeighborFlag(mp_flags[static_cast<std::size_t>(y) * m_width + x]);
+    return node;
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline TNode<CoordinateType, PriorityType> TMappedGrid<CoordinateType, PriorityType, Moves>::GetNodeAt(std::size_t index) const
+{
+    return GetNode(static_cast<CoordinateType>(index % m_width), static_cast<CoordinateType>(index / m_width));
+}
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TMappedGrid<CoordinateType, PriorityType, Moves>::GetNodeIndex(const TTNode& node) const
+{ return static_cast<std::size_t>(node.Y()) * m_width + node.X(); }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TMappedGrid<CoordinateType, PriorityType, Moves>::GetNodeCount() const
+{ return static_cast<std::size_t>(m_width) * m_height; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline CoordinateType TMappedGrid<CoordinateType, PriorityType, Moves>::GetWidth() const
+{ return m_width; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline CoordinateType TMappedGrid<CoordinateType, PriorityType, Moves>::GetHeight() const
+{ return m_height; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline bool TMappedGrid<CoordinateType, PriorityType, Moves>::IsReachable(const TTNode& from, const TTNode& to) const
+{ return mp_components[GetNodeIndex(from)] == mp_components[GetNodeIndex(to)]; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TMappedGrid<CoordinateType, PriorityType, Moves>::GetComponent(CoordinateType x, CoordinateType y) const
+{ return mp_components[static_cast<std::size_t>(y) * m_width + x]; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TMappedGrid<CoordinateType, PriorityType, Moves>::GetEpoch() const
+{ return 0; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TMappedGrid<CoordinateType, PriorityType, Moves>::GetNodeEpoch(std::size_t /* index */) const
+{ return 0; }
+
+template <typename CoordinateType, typename PriorityType, typename Moves>
+inline bool TMappedGrid<CoordinateType, PriorityType, Moves>::IsValidNode(CoordinateType x, CoordinateType y) const
+{ return (x >= 0 && x < m_width && y >= 0 && y < m_height); }
+
+} // !namespace nav
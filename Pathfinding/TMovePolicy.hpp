@@ -0,0 +1,74 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TMovePolicy.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_MOVE_POLICY_HPP
+#define PATHFINDING_T_MOVE_POLICY_HPP
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  Moves to the 4 direct neighbors only
+///         A move costs the cost of the entered node
+/// \tparam PriorityType The type of the priority
+template <typename PriorityType>
+struct TFourWayMoves
+{
+    static constexpr bool         DIAGONAL      = false; ///< Diagonal moves are disabled
+    static constexpr bool         CUT_CORNERS   = false; ///< Unused
+    static constexpr PriorityType STRAIGHT_COST = 1;     ///< Scale of a straight move
+    static constexpr PriorityType DIAGONAL_COST = 1;     ///< Unused
+};
+
+/// \brief  Moves to the 8 neighbors
+///
+///         A diagonal move needs the diagonal flags on both nodes and
+///         a straight detour through the corner nodes : both of them,
+///         or at least one if CutCorners is true. Diagonal moves thus
+///         never join two nodes that weren't already connected.
+///
+///         Costs are scaled by 10 to keep sqrt(2) as an integer.
+///
+/// \tparam PriorityType The type of the priority
+/// \tparam CutCorners True to allow moves along a blocked corner
+template <typename PriorityType, bool CutCorners = false>
+struct TEightWayMoves
+{
+    static constexpr bool         DIAGONAL      = true;       ///< Diagonal moves are enabled
+    static constexpr bool         CUT_CORNERS   = CutCorners; ///< One free corner is enough
+    static constexpr PriorityType STRAIGHT_COST = 10;         ///< Scale of a straight move
+    static constexpr PriorityType DIAGONAL_COST = 14;         ///< Scale of a diagonal move
+};
+
+template <typename PriorityType> constexpr bool         TFourWayMoves<PriorityType>::DIAGONAL;
+template <typename PriorityType> constexpr bool         TFourWayMoves<PriorityType>::CUT_CORNERS;
+template <typename PriorityType> constexpr PriorityType TFourWayMoves<PriorityType>::STRAIGHT_COST;
+template <typename PriorityType> constexpr PriorityType TFourWayMoves<PriorityType>::DIAGONAL_COST;
+
+template <typename PriorityType, bool CutCorners> constexpr bool         TEightWayMoves<PriorityType, CutCorners>::DIAGONAL;
+template <typename PriorityType, bool CutCorners> constexpr bool         TEightWayMoves<PriorityType, CutCorners>::CUT_CORNERS;
+template <typename PriorityType, bool CutCorners> constexpr PriorityType TEightWayMoves<PriorityType, CutCorners>::STRAIGHT_COST;
+template <typename PriorityType, bool CutCorners> constexpr PriorityType TEightWayMoves<PriorityType, CutCorners>::DIAGONAL_COST;
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_MOVE_POLICY_HPP
@@ -0,0 +1,121 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+/// \file       TMoveRules.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_MOVE_RULES_HPP
+#define PATHFINDING_T_MOVE_RULES_HPP
+
+#include <vector>
+#include <algorithm>
+
+#include "TMovePolicy.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TMoveRules
+/// \brief  The moves allowed from a node of a flag grid, shared by all grids
+///
+///         A straight move needs the flag of the direction on the node and
+///         the opposite flag on the neighbor. A diagonal move needs the same
+///         and the straight detour required by the move policy (see TMovePolicy.hpp).
+///
+///         Grids give the flags through an accessor : a callable (x, y)
+///         returning the neighbor flags of a node, 0 outside of the grid.
+///
+/// \tparam Node  The node class (see TNode)
+/// \tparam Moves The move policy of the grid
+template <typename Node, typename Moves>
+struct TMoveRules
+{
+    /// \brief  Puts into neighbors the nodes reachable from (x, y) in the order
+    ///         west, south, east, north, then diagonals, reversed on even cells
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  current The neighbor flags of the node
+    /// \param  flags The flag accessor of the grid
+    /// \param  node Callable (x, y, flags) returning the node at the given coordinates,
+    ///         given its neighbor flags
+    /// \param  neighbors The vector of neighbors
+    template <typename Flags, typename Maker>
+    static inline void GetNeighbors(int x, int y, unsigned char current, const Flags& flags, const Maker& node, std::vector<Node>& neighbors)
+    {
+        static const int           offsets  [8][2] = { { -1, 0 }, { 0, 1 }, { 1, 0 }, { 0, -1 },
+                                                       { 1, -1 }, { 1, 1 }, { -1, 1 }, { -1, -1 } };
+        static const unsigned char opposites[8]    = { Node::EAST, Node::NORTH, Node::WEST, Node::SOUTH,
+                                                       Node::SOUTH_WEST, Node::NORTH_WEST, Node::NORTH_EAST, Node::SOUTH_EAST };
+
+        const unsigned char shift = Moves::DIAGONAL ? 8 : 4;
+
+        for (unsigned char nShift = 0; nShift < shift; ++nShift)
+        {
+            if (!(current & (1 << nShift)))
+                continue;
+
+            const int dx = offsets[nShift][0];
+            const int dy = offsets[nShift][1];
+
+            const unsigned char next = flags(x + dx, y + dy);
+            if (!(next & opposites[nShift]))
+                continue;
+
+            if (nShift >= 4)
+            {
+                // Corner rule, the move must have a straight detour
+                const bool horizontal_first = HasEdge(x, y, dx, 0, flags) && HasEdge(x + dx, y, 0, dy, flags);
+                const bool vertical_first   = HasEdge(x, y, 0, dy, flags) && HasEdge(x, y + dy, dx, 0, flags);
+
+                if (Moves::CUT_CORNERS ? !(horizontal_first || vertical_first) : !(horizontal_first && vertical_first))
+                    continue;
+            }
+
+            neighbors.push_back(node(x + dx, y + dy, next));
+        }
+
+        // Small optimization for squared grid
+        if ((x + y) % 2 == 0)
+        {
+            std::reverse(neighbors.begin(), neighbors.end());
+        }
+    }
+
+    /// \brief  Tells if the straight edge between (x, y) and (x + dx, y + dy) exists
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  dx The X direction (-1, 0 or 1)
+    /// \param  dy The Y direction (-1, 0 or 1)
+    /// \param  flags The flag accessor of the grid
+    /// \return True or false
+    template <typename Flags>
+    static inline bool HasEdge(int x, int y, int dx, int dy, const Flags& flags)
+    {
+        const unsigned char flag     = dy < 0 ? Node::NORTH : dx > 0 ? Node::EAST : dy > 0 ? Node::SOUTH : Node::WEST;
+        const unsigned char opposite = dy < 0 ? Node::SOUTH : dx > 0 ? Node::WEST : dy > 0 ? Node::NORTH : Node::EAST;
+
+        return (flags(x, y) & flag) && (flags(x + dx, y + dy) & opposite);
+    }
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_MOVE_RULES_HPP
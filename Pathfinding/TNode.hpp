@@ -52,7 +52,13 @@ public:
         EAST  = 0x1 << 2,   ///< 0b00000100
         SOUTH = 0x1 << 1,   ///< 0b00000010
         WEST  = 0x1 << 0,   ///< 0b00000001
-        ALL   = 0xF         ///< 0b00001111
+        ALL   = 0xF,        ///< 0b00001111
+
+        NORTH_EAST = 0x1 << 4, ///< 0b00010000
+        SOUTH_EAST = 0x1 << 5, ///< 0b00100000
+        SOUTH_WEST = 0x1 << 6, ///< 0b01000000
+        NORTH_WEST = 0x1 << 7, ///< 0b10000000
+        DIAGONALS  = 0xF0      ///< 0b11110000, used by 8 way grids only
     };
 
     using TTNode = TNode<CoordinateType, PriorityType>;
@@ -77,6 +83,11 @@ public:
     /* inline */ TNode(const TNode& other) : xy(other.xy), m_priority(other.m_priority), m_neighbors(other.m_neighbors)
     { /* None */ }
 
+    /// \brief  Copy assignment, declared along the copy constructor
+    /// \param  other The node to copy
+    /// \return A reference on the current node
+    /* inline */ TNode& operator=(const TNode& other) = default;
+
     /// \brief  Default destructor
     /* inline */ ~TNode() = default;
 
@@ -0,0 +1,163 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TPathCache.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_PATH_CACHE_HPP
+#define PATHFINDING_T_PATH_CACHE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <unordered_map>
+
+#include "TNode.hpp"
+#include "TTieHelper.hpp"
+#include "TPathfinding.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TPathCache
+/// \brief  Bounded LRU cache of paths keyed by start / end nodes
+///
+///         Paths are stored as their first node followed by one
+///         direction per step, two steps per byte. Each entry keeps the
+///         grid epoch it was validated at : an entry is reused as is while
+///         the grid is unchanged, otherwise it is dropped only if one of
+///         its nodes was edited since (see Graph::GetNodeEpoch).
+///         Edits that open a shortcut elsewhere keep the cached path,
+///         which stays valid but may no longer be the shortest.
+///
+/// \tparam Graph The grid class
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+/// \tparam Pathfinding The search run on a miss
+template <typename Graph, typename CoordinateType, typename PriorityType,
+          typename Pathfinding = TPathfinding<Graph, CoordinateType, PriorityType>>
+class TPathCache
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  Creates an empty cache
+    /// \param  capacity The maximum number of paths
+    explicit TPathCache(std::size_t capacity);
+
+    /// \brief  Returns the cached path between start and end node,
+    ///         searches and caches it on a miss
+    /// \param  graph The graph to perform the search on
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return true if a path is found
+    bool GetPath(const Graph& graph, std::vector<TTNode>& path, const TTNode& start, const TTNode& end);
+
+    /// \brief  Drops all paths, counters are kept
+    void Clear();
+
+    /// \brief  Sets all counters to zero
+    void ResetCounters();
+
+    /// \brief  Returns the number of queries answered from the cache
+    inline std::size_t GetHitCount() const;
+
+    /// \brief  Returns the number of queries that ran a search
+    inline std::size_t GetMissCount() const;
+
+    /// \brief  Returns the number of paths dropped because of an edit
+    inline std::size_t GetInvalidationCount() const;
+
+    /// \brief  Returns the number of cached paths
+    inline std::size_t GetSize() const;
+
+    /// \brief  Returns the maximum number of cached paths
+    inline std::size_t GetCapacity() const;
+
+private:
+
+    using TTieType = typename TTieTypeHelper<CoordinateType>::TieType;
+
+    /// \brief  Marks the ends of the LRU list
+    static constexpr std::size_t NO_SLOT = static_cast<std::size_t>(-1);
+
+    /// \brief  The packed start and end coordinates
+    struct SKey
+    {
+        TTieType start; ///< The XY coordinate of the start node
+        TTieType end;   ///< The XY coordinate of the end node
+
+        bool operator==(const SKey& other) const
+        { return start == other.start && end == other.end; }
+    };
+
+    /// \brief  Functor to hash a key
+    struct SKeyHash
+    {
+        std::size_t operator()(const SKey& key) const
+        { return std::hash<std::uint64_t>()((static_cast<std::uint64_t>(key.start) * 0x9E3779B97F4A7C15ULL) ^ static_cast<std::uint64_t>(key.end)); }
+    };
+
+    /// \brief  A cached path and its links in the LRU list
+    struct SEntry
+    {
+        SKey                       key;             ///< The query
+        std::uint32_t              epoch = 0;       ///< The grid epoch of the last validation
+        CoordinateType             x     = 0;       ///< The X coordinate of the first node
+        CoordinateType             y     = 0;       ///< The Y coordinate of the first node
+        std::size_t                steps = 0;       ///< The number of steps
+        std::vector<unsigned char> codes;           ///< The directions, 4 bits per step
+        std::size_t                prev  = NO_SLOT; ///< The more recently used entry
+        std::size_t                next  = NO_SLOT; ///< The less recently used entry
+    };
+
+    /// \brief  Stores a path (in reverse order) in an entry
+    void Encode(const std::vector<TTNode>& path, std::size_t first, SEntry& entry) const;
+
+    /// \brief  Appends the path of an entry, fails if one of its nodes was edited
+    bool Decode(const Graph& graph, const SEntry& entry, std::vector<TTNode>& path) const;
+
+    /// \brief  Removes an entry from the LRU list
+    void Unlink(std::size_t slot);
+
+    /// \brief  Puts an entry at the front of the LRU list
+    void PushFront(std::size_t slot);
+
+    /// \brief  Drops an entry and frees its slot
+    void Remove(std::size_t slot);
+
+    std::size_t                                     m_capacity;                ///< The maximum number of paths
+    std::vector<SEntry>                             m_entries;                 ///< The slots
+    std::vector<std::size_t>                        m_free_slots;              ///< The unused slots
+    std::unordered_map<SKey, std::size_t, SKeyHash> m_slots;                   ///< Query to slot
+    std::size_t                                     m_head          = NO_SLOT; ///< The most recently used
+    std::size_t                                     m_tail          = NO_SLOT; ///< The least recently used
+    std::size_t                                     m_hits          = 0;       ///< Queries answered from the cache
+    std::size_t                                     m_misses        = 0;       ///< Queries that ran a search
+    std::size_t                                     m_invalidations = 0;       ///< Paths dropped by edits
+};
+
+} // !namespace nav
+
+#include "TPathCache.inl"
+
+#endif // PATHFINDING_T_PATH_CACHE_HPP
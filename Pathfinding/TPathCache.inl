@@ -0,0 +1,254 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TPathCache.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+/// \namespace nav
+namespace nav
+{
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+constexpr std::size_t TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::NO_SLOT;
+
+/// \brief  Creates an empty cache
+/// \param  capacity The maximum number of paths
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::TPathCache(std::size_t capacity)
+: m_capacity(capacity)
+{
+    m_entries.reserve(capacity);
+    m_slots.reserve(capacity);
+}
+
+/// \brief  Returns the cached path between start and end node,
+///         searches and caches it on a miss
+/// \param  graph The graph to perform the search on
+/// \param  path The vector to store the result (in reverse order)
+/// \param  start The start node
+/// \param  end The end node
+/// \return true if a path is found
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+bool TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::GetPath(const Graph& graph, std::vector<TTNode>& path, const TTNode& start, const TTNode& end)
+{
+    const SKey key { start.XY(), end.XY() };
+
+    auto found = m_slots.find(key);
+    if (found != m_slots.end())
+    {
+        const std::size_t slot = found->second;
+
+        if (Decode(graph, m_entries[slot], path))
+        {
+            // Checked against the current epoch, the next hit is free
+            m_entries[slot].epoch = graph.GetEpoch();
+
+            Unlink(slot);
+            PushFront(slot);
+            ++m_hits;
+            return true;
+        }
+
+        Remove(slot);
+        ++m_invalidations;
+    }
+
+    ++m_misses;
+
+    const std::size_t first = path.size();
+    if (!Pathfinding::GetPath(graph, path, start, end))
+        return false;
+
+    if (m_capacity == 0)
+        return true;
+
+    // Reuses the least recently used slot once full
+    std::size_t slot;
+    if (m_slots.size() == m_capacity)
+    {
+        slot = m_tail;
+        m_slots.erase(m_entries[slot].key);
+        Unlink(slot);
+    }
+    else if (!m_free_slots.empty())
+    {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    }
+    else
+    {
+        slot = m_entries.size();
+        m_entries.emplace_back();
+    }
+
+    SEntry& entry = m_entries[slot];
+    entry.key     = key;
+    entry.epoch   = graph.GetEpoch();
+    Encode(path, first, entry);
+
+    m_slots.emplace(key, slot);
+    PushFront(slot);
+    return true;
+}
+
+/// \brief  Drops all paths, counters are kept
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+void TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::Clear()
+{
+    m_entries.clear();
+    m_free_slots.clear();
+    m_slots.clear();
+    m_head = NO_SLOT;
+    m_tail = NO_SLOT;
+}
+
+/// \brief  Sets all counters to zero
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+void TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::ResetCounters()
+{
+    m_hits          = 0;
+    m_misses        = 0;
+    m_invalidations = 0;
+}
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+inline std::size_t TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::GetHitCount() const
+{ return m_hits; }
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+inline std::size_t TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::GetMissCount() const
+{ return m_misses; }
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+inline std::size_t TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::GetInvalidationCount() const
+{ return m_invalidations; }
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+inline std::size_t TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::GetSize() const
+{ return m_slots.size(); }
+
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+inline std::size_t TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::GetCapacity() const
+{ return m_capacity; }
+
+/// \brief  Stores a path (in reverse order) in an entry
+/// \param  path The vector holding the path
+/// \param  first The index of the first node of the path in the vector
+/// \param  entry The entry to fill
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+void TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::Encode(const std::vector<TTNode>& path, std::size_t first, SEntry& entry) const
+{
+    // The code of a step, indexed by (dy + 1) * 3 + (dx + 1)
+    static const unsigned char codes[9] = { 7, 0, 4, 3, 0, 1, 6, 2, 5 };
+
+    entry.x     = path[first].X();
+    entry.y     = path[first].Y();
+    entry.steps = path.size() - first - 1;
+    entry.codes.assign((entry.steps + 1) / 2, 0);
+
+    for (std::size_t step = 0; step < entry.steps; ++step)
+    {
+        const TTNode& from = path[first + step];
+        const TTNode& to   = path[first + step + 1];
+        const int     code = codes[(to.Y() - from.Y() + 1) * 3 + (to.X() - from.X() + 1)];
+
+        entry.codes[step / 2] |= static_cast<unsigned char>(code << ((step % 2) * 4));
+    }
+}
+
+/// \brief  Appends the path of an entry, fails if one of its nodes was edited
+/// \param  graph The graph the path was found on
+/// \param  entry The entry to decode
+/// \param  path The vector to store the result (in reverse order)
+/// \return false if the path is stale, path is then left unchanged
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+bool TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::Decode(const Graph& graph, const SEntry& entry, std::vector<TTNode>& path) const
+{
+    static const int directions[8][2] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 },
+                                          { 1, -1 }, { 1, 1 }, { -1, 1 }, { -1, -1 } };
+
+    const std::size_t first   = path.size();
+    const bool        checked = entry.epoch == graph.GetEpoch();
+
+    int x = entry.x;
+    int y = entry.y;
+
+    for (std::size_t step = 0; ; ++step)
+    {
+        const TTNode& node = graph.GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y));
+
+        if (!checked && graph.GetNodeEpoch(graph.GetNodeIndex(node)) > entry.epoch)
+        {
+            path.erase(path.begin() + first, path.end());
+            return false;
+        }
+
+        path.push_back(node);
+        if (step == entry.steps)
+            return true;
+
+        const int code = (entry.codes[step / 2] >> ((step % 2) * 4)) & 0xF;
+        x += directions[code][0];
+        y += directions[code][1];
+    }
+}
+
+/// \brief  Removes an entry from the LRU list
+/// \param  slot The slot of the entry
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+void TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::Unlink(std::size_t slot)
+{
+    SEntry& entry = m_entries[slot];
+
+    if (entry.prev != NO_SLOT) m_entries[entry.prev].next = entry.next;
+    else                       m_head = entry.next;
+
+    if (entry.next != NO_SLOT) m_entries[entry.next].prev = entry.prev;
+    else                       m_tail = entry.prev;
+
+    entry.prev = NO_SLOT;
+    entry.next = NO_SLOT;
+}
+
+/// \brief  Puts an entry at the front of the LRU list
+/// \param  slot The slot of the entry
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+void TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::PushFront(std::size_t slot)
+{
+    SEntry& entry = m_entries[slot];
+    entry.prev = NO_SLOT;
+    entry.next = m_head;
+
+    if (m_head != NO_SLOT) m_entries[m_head].prev = slot;
+    else                   m_tail = slot;
+
+    m_head = slot;
+}
+
+/// \brief  Drops an entry and frees its slot
+/// \param  slot The slot of the entry
+template <typename Graph, typename CoordinateType, typename PriorityType, typename Pathfinding>
+void TPathCache<Graph, CoordinateType, PriorityType, Pathfinding>::Remove(std::size_t slot)
+{
+    m_slots.erase(m_entries[slot].key);
+    Unlink(slot);
+    m_free_slots.push_back(slot);
+}
+
+} // !namespace nav
@@ -24,31 +24,39 @@
 #define PATHFINDING_T_PATHFINDING_HPP
 
 #include <cmath>
-#include <queue>
+#include <memory>
 #include <vector>
 #include <algorithm>
-#include <unordered_map>
 
 #include "TNode.hpp"
+#include "THeuristic.hpp"
+#include "TSearchState.hpp"
+#include "TSearchStats.hpp"
+#include "CWorkStealingPool.hpp"
 
 /// \namespace nav
 namespace nav
 {
 
-/// \brief Computes the manhattan distance between two nodes
-template<typename CoordinateType, typename PriorityType>
-/* inline */ PriorityType Heuristic(const TNode<CoordinateType, PriorityType> &lhs,
-                                    const TNode<CoordinateType, PriorityType> &rhs)
-{
-    return abs(lhs.X() - rhs.X()) + abs(lhs.Y() - rhs.Y());
-}
-
 /// \class  TPathfinding
 /// \brief  Helper class to compute the shortest path between two points
+///
+///         The search state stores the visited nodes as the graph asks
+///         (see TGraphEntries), paged on graphs too large for flat arrays.
+///
 /// \tparam Graph The graph class
 /// \tparam CoordinateType The type of coordinates
 /// \tparam PriorityType The type of the priority
-template<typename Graph, typename CoordinateType, typename PriorityType>
+/// \tparam HeuristicPolicy The heuristic, must match the moves of the graph (see THeuristic.hpp)
+/// \tparam FrontierPolicy The open list (see TFrontier.hpp)
+/// \tparam StatsPolicy The per query statistics, none by default (see TSearchStats.hpp)
+/// \tparam AllocatorPolicy The allocator of the search state, must match the one
+///         of the frontier (see TArenaAllocator.hpp)
+template<typename Graph, typename CoordinateType, typename PriorityType,
+         typename HeuristicPolicy = TManhattanHeuristic<CoordinateType, PriorityType>,
+         typename FrontierPolicy  = TDefaultFrontier<CoordinateType, PriorityType>,
+         typename StatsPolicy     = TNoSearchStats<CoordinateType, PriorityType>,
+         typename AllocatorPolicy = std::allocator<TNode<CoordinateType, PriorityType>>>
 class TPathfinding
 {
 public:
@@ -56,72 +64,250 @@ public:
     using TTNode        =  TNode        <CoordinateType, PriorityType>;
     using TTNodeHash    =  TNodeHash    <CoordinateType, PriorityType>;
     using TTNodeCompare =  TNodeCompare <CoordinateType, PriorityType>;
+    using TTFrontier    =  FrontierPolicy;
+    using TTStats       =  StatsPolicy;
+    using TTEntries     =  typename TGraphEntries<Graph, PriorityType, AllocatorPolicy>::TTEntries;
+    using TTSearchState =  TSearchState <CoordinateType, PriorityType, FrontierPolicy, StatsPolicy, AllocatorPolicy, TTEntries>;
+
+    /// \brief  A start / end pair of a batch
+    struct SQuery
+    {
+        TTNode start; ///< The start node
+        TTNode end;   ///< The end node
+    };
+
+    /// \brief  Finds the paths of a batch of queries on a pool of workers.
+    ///         The graph is shared read only, each worker has its own state.
+    /// \param  graph The graph to perform the searches on
+    /// \param  pool The workers
+    /// \param  states The scratch states, one per worker (resized if needed)
+    /// \param  queries The queries
+    /// \param  count The number of queries
+    /// \param  paths The preallocated result slots, one per query (in reverse order)
+    /// \param  found The preallocated result flags, one per query
+    /// \param  grain The number of queries per stolen chunk
+    static void GetPaths(const Graph& graph, CWorkStealingPool& pool, std::vector<TTSearchState>& states,
+                         const SQuery* queries, std::size_t count,
+                         std::vector<TTNode>* paths, bool* found, std::size_t grain = 16)
+    {
+        GetPaths(graph, HeuristicPolicy(), pool, states, queries, count, paths, found, grain);
+    }
+
+    /// \brief  Finds the paths of a batch of queries on a pool of workers
+    ///         with a heuristic instance shared read only by the workers
+    /// \param  graph The graph to perform the searches on
+    /// \param  heuristic The heuristic
+    /// \param  pool The workers
+    /// \param  states The scratch states, one per worker (resized if needed,
+    ///         states on arenas must be created beforehand, one arena each)
+    /// \param  queries The queries
+    /// \param  count The number of queries
+    /// \param  paths The preallocated result slots, one per query (in reverse order)
+    /// \param  found The preallocated result flags, one per query
+    /// \param  grain The number of queries per stolen chunk
+    static void GetPaths(const Graph& graph, const HeuristicPolicy& heuristic, CWorkStealingPool& pool,
+                         std::vector<TTSearchState>& states, const SQuery* queries, std::size_t count,
+                         std::vector<TTNode>* paths, bool* found, std::size_t grain = 16)
+    {
+        if (states.size() < pool.GetThreadCount())
+        {
+            states.resize(pool.GetThreadCount());
+        }
+
+        pool.ParallelFor(count, grain, [&](std::size_t worker, std::size_t begin, std::size_t end)
+        {
+            TTSearchState& state = states[worker];
+            for (std::size_t query = begin; query < end; ++query)
+            {
+                paths[query].clear();
+                found[query] = GetPath(graph, heuristic, state, paths[query], queries[query].start, queries[query].end);
+            }
+        });
+    }
+
+    /// \brief  Finds one of the shortest path between start and end node.
+    ///         Uses a search state owned by the calling thread
+    ///         so buffers are reused from one query to the next.
+    /// \param  graph The graph to perform the search on
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return true if a path is found
+    static bool GetPath(const Graph& graph, std::vector<TTNode>& path, const TTNode& start, const TTNode& end)
+    {
+        static thread_local TTSearchState state;
+        return GetPath(graph, state, path, start, end);
+    }
 
     /// \brief  Finds one of the shortest path between start and end node.
     /// \param  graph The graph to perform the search on
+    /// \param  state The scratch state of the search, reused between queries
+    /// \param  path The vector to store the result (in reverse order)
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return true if a path is found
+    static bool GetPath(const Graph& graph, TTSearchState& state, std::vector<TTNode>& path, const TTNode& start, const TTNode& end)
+    {
+        return GetPath(graph, HeuristicPolicy(), state, path, start, end);
+    }
+
+    /// \brief  Finds one of the shortest path between start and end node
+    ///         with a heuristic instance, for heuristics holding data
+    ///         (see TLandmarkHeuristic)
+    /// \param  graph The graph to perform the search on
+    /// \param  heuristic The heuristic
+    /// \param  state The scratch state of the search, reused between queries
     /// \param  path The vector to store the result (in reverse order)
     /// \param  start The start node
     /// \param  end The end node
     /// \return true if a path is found
-    static bool GetPath(Graph& graph, std::vector<TTNode>& path, const TTNode& start, const TTNode& end)
+    static bool GetPath(const Graph& graph, const HeuristicPolicy& heuristic, TTSearchState& state,
+                        std::vector<TTNode>& path, const TTNode& start, const TTNode& end)
     {
+        StatsPolicy& stats = state.GetStats();
+        stats.BeginQuery(TTSearchState::GetEntrySize());
+
+        // Different components, the search would explore
+        // the whole component of start for nothing
+        if (!graph.IsReachable(start, end))
+        {
+            stats.EndQuery(false);
+            return false;
+        }
+
+        state.BeginQuery(graph.GetNodeCount());
+        PushStart(graph, heuristic, state, start, end);
+
+        const std::size_t start_index = graph.GetNodeIndex(start);
+        const std::size_t end_index   = graph.GetNodeIndex(end);
+
+        std::size_t  current_index = 0;
+        PriorityType current_h     = 0;
+        EStep        step          = EXPANDED;
+
+        while (step == EXPANDED)
+        {
+            step = Expand(graph, heuristic, state, end, end_index, current_index, current_h);
+        }
+
         // Tells if there is a path between start and end
-        bool  has_path = false;
+        const bool has_path = step == FOUND;
+
+        if(has_path)
+        {
+            std::size_t current = end_index;
+            path.push_back(end);
+            while (current != start_index)
+            {
+                current = state.GetParent(current);
+                path.push_back(graph.GetNodeAt(current));
+            }
+        }
+
+        stats.EndQuery(has_path);
+        return has_path;
+    }
 
-        std::vector         <TTNode> neighbors;
-        std::priority_queue <TTNode> frontier;
-        std::unordered_map  <TTNode, TTNode,        TTNodeHash, TTNodeCompare> came_from;
-        std::unordered_map  <TTNode, PriorityType,  TTNodeHash, TTNodeCompare> cost_so_far;
+    /// \brief  The outcome of an expansion step
+    /// \enum   EStep
+    enum EStep : int
+    {
+        EXPANDED  = 0, ///< A node was expanded, the search goes on
+        FOUND     = 1, ///< The end node was popped
+        EXHAUSTED = 2  ///< The frontier is empty, there is no path
+    };
 
-        frontier.emplace   (TTNode(start));
-        cost_so_far.emplace(TTNode(start), 0);
-        came_from.emplace  (TTNode(start), start);
+    /// \brief  Pushes the start node of a query on the frontier of a state
+    ///         The state must be prepared with BeginQuery
+    /// \param  graph The graph to perform the search on
+    /// \param  heuristic The heuristic
+    /// \param  state The state of the search
+    /// \param  start The start node
+    /// \param  end The end node
+    static void PushStart(const Graph& graph, const HeuristicPolicy& heuristic, TTSearchState& state,
+                          const TTNode& start, const TTNode& end)
+    {
+        const std::size_t start_index = graph.GetNodeIndex(start);
 
-        while (!frontier.empty())
+        // The priority of the given node is unknown,
+        // a large one would be dropped by the stale check
+        TTNode first(start);
+        first.SetPriority(heuristic.Compute(start, end));
+
+        state.GetFrontier().Push(first);
+        state.Visit(start_index, 0, start_index);
+        state.GetStats().OnPush(first);
+        state.GetStats().OnVisit(start_index, false);
+    }
+
+    /// \brief  Pops nodes until one is expanded, the end node
+    ///         is popped or the frontier is empty. The A* step shared
+    ///         by GetPath and the time sliced search (see TResumableSearch)
+    /// \param  graph The graph to perform the search on
+    /// \param  heuristic The heuristic
+    /// \param  state The state of the search
+    /// \param  end The end node
+    /// \param  end_index The index of the end node
+    /// \param  current_index The index of the expanded node, set if EXPANDED
+    /// \param  current_h The heuristic of the expanded node, set if EXPANDED
+    /// \return The outcome of the step
+    static EStep Expand(const Graph& graph, const HeuristicPolicy& heuristic, TTSearchState& state,
+                        const TTNode& end, std::size_t end_index,
+                        std::size_t& current_index, PriorityType& current_h)
+    {
+        StatsPolicy&          stats     = state.GetStats();
+        TTFrontier&           frontier  = state.GetFrontier();
+        std::vector <TTNode>& neighbors = state.GetNeighbors();
+
+        while (!frontier.IsEmpty())
         {
-            TTNode current(frontier.top());
-            frontier.pop();
+            TTNode current(frontier.Pop());
+            stats.OnPop(current);
+
+            current_index = graph.GetNodeIndex(current);
 
             // Early exit, the pathfinding has found
             // the exit for the first time
-            if (current == end)
+            if (current_index == end_index)
+                return FOUND;
+
+            const PriorityType current_cost = state.GetCost(current_index);
+            current_h = heuristic.Compute(current, end);
+
+            // The node has been pushed again with a better cost
+            // since this entry was queued, it is already expanded
+            if (current.GetPriority() > current_cost + current_h)
             {
-                has_path = true;
-                break;
+                stats.OnStale(current);
+                continue;
             }
 
+            stats.OnExpand(current, current_index);
+
             neighbors.clear();
             graph.GetNeighbors(current, neighbors);
 
             for (TTNode& next : neighbors)
             {
-                int new_cost = cost_so_far[current];
+                const std::size_t  next_index = graph.GetNodeIndex(next);
+                const PriorityType new_cost   = current_cost + graph.GetCost(current, next);
+                const bool         visited    = state.IsVisited(next_index);
 
-                if (!cost_so_far.count(next) || new_cost < cost_so_far[next])
+                if (!visited || new_cost < state.GetCost(next_index))
                 {
-                    cost_so_far[next] = new_cost;
-                    PriorityType priority = new_cost + Heuristic<CoordinateType, PriorityType>(next, end);
-
-                    next.SetPriority(priority);
-                    frontier.push(next);
+                    state.Visit(next_index, new_cost, current_index);
 
-                    came_from[next] = current;
+                    next.SetPriority(new_cost + heuristic.Compute(next, end));
+                    frontier.Push(next);
+                    stats.OnPush(next);
+                    stats.OnVisit(next_index, visited);
                 }
             }
-        }
 
-        if(has_path)
-        {
-            TTNode current = end;
-            path.push_back(end);
-            while (current != start)
-            {
-                current = came_from[current];
-                path.push_back(current);
-            }
+            return EXPANDED;
         }
 
-        return has_path;
+        return EXHAUSTED;
     }
 };
 
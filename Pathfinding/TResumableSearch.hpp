@@ -0,0 +1,256 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TResumableSearch.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_RESUMABLE_SEARCH_HPP
+#define PATHFINDING_T_RESUMABLE_SEARCH_HPP
+
+#include <chrono>
+#include <vector>
+#include <cstdlib>
+
+#include "TNode.hpp"
+#include "THeuristic.hpp"
+#include "TSearchState.hpp"
+#include "TSearchStats.hpp"
+#include "TPathfinding.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TResumableSearch
+/// \brief  A* search run in slices, to spread a long query over frames
+///
+///         The search owns its state, each Step expands a bounded number
+///         of nodes and returns. The graph must not be edited while the
+///         search is in progress. The best node reached so far, the one
+///         with the lowest heuristic, gives a partial path to move along
+///         before the search completes.
+///
+///         Statistics span the whole search, wall time included
+///         the time between steps.
+///
+/// \tparam Graph The graph class
+/// \tparam CoordinateType The type of coordinates
+/// \tparam PriorityType The type of the priority
+/// \tparam HeuristicPolicy The heuristic, must match the moves of the graph (see THeuristic.hpp)
+/// \tparam FrontierPolicy The open list (see TFrontier.hpp)
+/// \tparam StatsPolicy The per query statistics, none by default (see TSearchStats.hpp)
+template<typename Graph, typename CoordinateType, typename PriorityType,
+         typename HeuristicPolicy = TManhattanHeuristic<CoordinateType, PriorityType>,
+         typename FrontierPolicy  = TDefaultFrontier<CoordinateType, PriorityType>,
+         typename StatsPolicy     = TNoSearchStats<CoordinateType, PriorityType>>
+class TResumableSearch
+{
+public:
+
+    using TTNode        = TNode        <CoordinateType, PriorityType>;
+    using TTGraph       = Graph;
+    using TTHeuristic   = HeuristicPolicy;
+    using TTPathfinding = TPathfinding <Graph, CoordinateType, PriorityType, HeuristicPolicy, FrontierPolicy, StatsPolicy>;
+    using TTSearchState = typename TTPathfinding::TTSearchState;
+    using TTClock       = std::chrono::steady_clock;
+
+    /// \brief  The progress of a search
+    /// \enum   EStatus
+    enum EStatus : int
+    {
+        IDLE        = 0, ///< Not initialized
+        IN_PROGRESS = 1, ///< Nodes are left to expand
+        FOUND       = 2, ///< The end node is reached
+        FAILED      = 3  ///< There is no path
+    };
+
+    /// \brief  Nodes expanded between two clock reads in StepFor
+    static constexpr std::size_t CLOCK_STRIDE = 32;
+
+    TResumableSearch() = default;
+
+    /// \brief  Uses a heuristic instance (see TLandmarkHeuristic)
+    explicit TResumableSearch(const HeuristicPolicy& heuristic)
+    : m_heuristic(heuristic)
+    { /* None */ }
+
+    /// \brief  Starts a new search, the previous one is dropped
+    ///         Buffers are kept from one search to the next
+    /// \param  graph The graph, must outlive the search
+    /// \param  start The start node
+    /// \param  end The end node
+    void Initialize(const Graph& graph, const TTNode& start, const TTNode& end)
+    {
+        mp_graph      = &graph;
+        m_end         = end;
+        m_start_index = graph.GetNodeIndex(start);
+        m_end_index   = graph.GetNodeIndex(end);
+        m_best_index  = m_start_index;
+        m_best_h      = m_heuristic.Compute(start, end);
+        m_expanded    = 0;
+
+        StatsPolicy& stats = m_state.GetStats();
+        stats.BeginQuery(TTSearchState::GetEntrySize());
+
+        // Different components, nothing to expand
+        if (!graph.IsReachable(start, end))
+        {
+            Finish(FAILED);
+            return;
+        }
+
+        m_state.BeginQuery(graph.GetNodeCount());
+        TTPathfinding::PushStart(graph, m_heuristic, m_state, start, end);
+
+        m_status = IN_PROGRESS;
+    }
+
+    /// \brief  Expands at most a number of nodes
+    /// \param  budget The maximum number of expanded nodes
+    /// \return The status of the search
+    EStatus Step(std::size_t budget)
+    {
+        for (std::size_t n = 0; n < budget && m_status == IN_PROGRESS; ++n)
+            Expand();
+
+        return m_status;
+    }
+
+    /// \brief  Expands nodes until a duration is spent, the clock is read
+    ///         every CLOCK_STRIDE expansions so the step may run a bit over
+    /// \param  budget The duration of the step
+    /// \return The status of the search
+    EStatus StepFor(std::chrono::microseconds budget)
+    {
+        const TTClock::time_point deadline = TTClock::now() + budget;
+
+        while (m_status == IN_PROGRESS)
+        {
+            Step(CLOCK_STRIDE);
+
+            if (TTClock::now() >= deadline)
+                break;
+        }
+
+        return m_status;
+    }
+
+    /// \brief  Returns the path once found
+    /// \param  path The vector to store the result (in reverse order)
+    /// \return false if the search is not FOUND
+    bool GetPath(std::vector<TTNode>& path) const
+    {
+        if (m_status != FOUND)
+            return false;
+
+        AppendPath(m_end_index, path);
+        return true;
+    }
+
+    /// \brief  Returns the path to the expanded node closest to the end
+    ///         node, by the heuristic. It is the full path once found
+    /// \param  path The vector to store the result (in reverse order)
+    /// \return false if the search is IDLE or has nothing expanded
+    bool GetPartialPath(std::vector<TTNode>& path) const
+    {
+        if (m_status == IDLE || (m_status == FAILED && m_expanded == 0))
+            return false;
+
+        AppendPath(m_status == FOUND ? m_end_index : m_best_index, path);
+        return true;
+    }
+
+    /// \brief  Returns the status of the search
+    EStatus GetStatus() const
+    { return m_status; }
+
+    /// \brief  Returns the number of nodes expanded since Initialize
+    std::size_t GetExpandedCount() const
+    { return m_expanded; }
+
+    /// \brief  Returns the statistics of the search
+    const StatsPolicy& GetStats() const
+    { return m_state.GetStats(); }
+
+    /// \brief  Returns the number of bytes used by the search state
+    std::size_t GetMemoryUsage() const
+    { return m_state.GetMemoryUsage(); }
+
+private:
+
+    /// \brief  Pops nodes until one is expanded or the search completes
+    ///         The A* step of TPathfinding, the best node is tracked here
+    void Expand()
+    {
+        std::size_t  current_index = 0;
+        PriorityType current_h     = 0;
+
+        switch (TTPathfinding::Expand(*mp_graph, m_heuristic, m_state, m_end, m_end_index, current_index, current_h))
+        {
+            case TTPathfinding::EXPANDED:
+                ++m_expanded;
+                if (current_h < m_best_h)
+                {
+                    m_best_h     = current_h;
+                    m_best_index = current_index;
+                }
+                break;
+
+            case TTPathfinding::FOUND:     Finish(FOUND);  break;
+            case TTPathfinding::EXHAUSTED: Finish(FAILED); break;
+        }
+    }
+
+    /// \brief  Ends the search
+    void Finish(EStatus status)
+    {
+        m_status = status;
+        m_state.GetStats().EndQuery(status == FOUND);
+    }
+
+    /// \brief  Walks the parents from a visited node back to the start node
+    void AppendPath(std::size_t index, std::vector<TTNode>& path) const
+    {
+        path.push_back(mp_graph->GetNodeAt(index));
+        while (index != m_start_index)
+        {
+            index = m_state.GetParent(index);
+            path.push_back(mp_graph->GetNodeAt(index));
+        }
+    }
+
+    const Graph*    mp_graph      = nullptr; ///< The searched graph
+    HeuristicPolicy m_heuristic;             ///< The heuristic
+    TTSearchState   m_state;                 ///< The frontier and the visited nodes
+    TTNode          m_end;                   ///< The end node
+    std::size_t     m_start_index = 0;       ///< The index of the start node
+    std::size_t     m_end_index   = 0;       ///< The index of the end node
+    std::size_t     m_best_index  = 0;       ///< The expanded node closest to the end
+    PriorityType    m_best_h      = 0;       ///< The heuristic of the best node
+    std::size_t     m_expanded    = 0;       ///< The expanded nodes
+    EStatus         m_status      = IDLE;    ///< The progress of the search
+};
+
+template<typename Graph, typename CoordinateType, typename PriorityType,
+         typename HeuristicPolicy, typename FrontierPolicy, typename StatsPolicy>
+constexpr std::size_t TResumableSearch<Graph, CoordinateType, PriorityType, HeuristicPolicy, FrontierPolicy, StatsPolicy>::CLOCK_STRIDE;
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_RESUMABLE_SEARCH_HPP
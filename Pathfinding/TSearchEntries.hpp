@@ -0,0 +1,304 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TSearchEntries.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_SEARCH_ENTRIES_HPP
+#define PATHFINDING_T_SEARCH_ENTRIES_HPP
+
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <cstdint> ///< std::uint32_t
+#include <cstdlib> ///< std::size_t
+#include <cstddef> ///< std::ptrdiff_t
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TDenseEntries
+/// \brief  Stores the visited nodes of a search in one flat array
+///         indexed by node (see Graph::GetNodeIndex)
+///
+///         Each entry is stamped with the generation of the query
+///         that wrote it. Starting a new query only bumps the generation,
+///         stale entries are then seen as unvisited and nothing is cleared.
+///         The array spans the whole graph, whatever the query explores.
+///
+/// \tparam PriorityType The type of the priority
+/// \tparam Allocator    The allocator, rebound to the entries (see TArenaAllocator.hpp)
+template <typename PriorityType, typename Allocator>
+class TDenseEntries
+{
+public:
+
+    /// \brief  Creates an empty array
+    explicit TDenseEntries(const Allocator& allocator = Allocator())
+    : m_entries(TTEntryAllocator(allocator))
+    { /* None */ }
+
+    /// \brief  Prepares the entries for a new query on a graph of nodeCount nodes
+    /* inline */ void BeginQuery(std::size_t nodeCount)
+    {
+        if (m_entries.size() < nodeCount)
+        {
+            m_entries.resize(nodeCount);
+        }
+
+        // On wrap around, old stamps could collide with the new generation
+        if (++m_generation == 0)
+        {
+            for (SEntry& entry : m_entries)
+                entry.generation = 0;
+
+            m_generation = 1;
+        }
+    }
+
+    /// \brief  Tells if the node has been reached during the current query
+    /* inline */ bool IsVisited(std::size_t index) const
+    { return m_entries[index].generation == m_generation; }
+
+    /// \brief  Returns the cost so far of a visited node
+    /* inline */ PriorityType GetCost(std::size_t index) const
+    { return m_entries[index].cost; }
+
+    /// \brief  Returns the index of the node we came from
+    /* inline */ std::size_t GetParent(std::size_t index) const
+    { return m_entries[index].parent; }
+
+    /// \brief  Marks a node as visited for the current query
+    /* inline */ void Visit(std::size_t index, PriorityType cost, std::size_t parent)
+    {
+        SEntry& entry    = m_entries[index];
+        entry.generation = m_generation;
+        entry.cost       = cost;
+        entry.parent     = parent;
+    }
+
+    /// \brief  Returns the size of the state of a visited node
+    static constexpr std::size_t GetEntrySize()
+    { return sizeof(SEntry); }
+
+    /// \brief  Returns the number of bytes used by the entries
+    /* inline */ std::size_t GetMemoryUsage() const
+    { return m_entries.capacity() * sizeof(SEntry); }
+
+private:
+
+    /// \brief  Everything a relaxation reads or writes
+    ///         is kept together on the same cache line
+    struct SEntry
+    {
+        std::uint32_t generation = 0; ///< The query that wrote the entry
+        PriorityType  cost       = 0; ///< The cost so far
+        std::size_t   parent     = 0; ///< The index of the node we came from
+    };
+
+    using TTEntryAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<SEntry>;
+
+    std::uint32_t                         m_generation = 0; ///< The current query
+    std::vector<SEntry, TTEntryAllocator> m_entries;        ///< One entry per node
+};
+
+/// \class  TPagedEntries
+/// \brief  Stores the visited nodes of a search in pages of PageSize
+///         consecutive node indices, allocated on first touch
+///
+///         Only the page table spans the whole graph, a few bytes per
+///         page. The entries follow the area explored by the queries :
+///         the pages the last query didn't touch are recycled when the
+///         next one starts, spare pages beyond the live ones are freed. Entries are stamped with the generation of their
+///         query like the dense ones. Graphs whose indices keep close
+///         nodes close, chunk by chunk (see TChunkedGrid), touch the
+///         fewest pages.
+///
+/// \tparam PriorityType The type of the priority
+/// \tparam Allocator    The allocator, rebound to the entries (see TArenaAllocator.hpp)
+/// \tparam PageSize     The number of entries of a page
+template <typename PriorityType, typename Allocator, std::size_t PageSize = 4096>
+class TPagedEntries
+{
+public:
+
+    static_assert(PageSize > 0, "TPagedEntries pages can't be empty");
+
+    /// \brief  Creates an empty page table
+    explicit TPagedEntries(const Allocator& allocator = Allocator())
+    : m_allocator(allocator)
+    { /* None */ }
+
+    /// \brief  Prepares the entries for a new query on a graph of nodeCount nodes
+    /* inline */ void BeginQuery(std::size_t nodeCount)
+    {
+        const std::size_t page_count = (nodeCount + PageSize - 1) / PageSize;
+        if (m_pages.size() < page_count)
+        {
+            m_pages  .resize(page_count, TTPage(m_allocator));
+            m_touched.resize(page_count, 0);
+        }
+
+        // Recycles the pages left out by the last query
+        std::size_t kept = 0;
+        for (std::size_t page : m_used)
+        {
+            if (m_touched[page] == m_generation)
+            {
+                m_used[kept++] = page;
+            }
+            else
+            {
+                m_spare.emplace_back(m_allocator);
+                m_spare.back().swap(m_pages[page]);
+            }
+        }
+        m_used.resize(kept);
+
+        // No more spare pages than live ones, the memory follows the explored area
+        if (m_spare.size() > kept)
+        {
+            m_spare.erase(m_spare.begin() + static_cast<std::ptrdiff_t>(kept), m_spare.end());
+        }
+
+        // On wrap around, old stamps could collide with the new generation
+        if (++m_generation == 0)
+        {
+            for (std::size_t page : m_used)
+                Reset(m_pages[page]);
+
+            for (TTPage& page : m_spare)
+                Reset(page);
+
+            std::fill(m_touched.begin(), m_touched.end(), 0);
+            m_generation = 1;
+        }
+    }
+
+    /// \brief  Tells if the node has been reached during the current query
+    /* inline */ bool IsVisited(std::size_t index) const
+    {
+        const TTPage& page = m_pages[index / PageSize];
+        return !page.empty() && page[index % PageSize].generation == m_generation;
+    }
+
+    /// \brief  Returns the cost so far of a visited node
+    /* inline */ PriorityType GetCost(std::size_t index) const
+    { return m_pages[index / PageSize][index % PageSize].cost; }
+
+    /// \brief  Returns the index of the node we came from
+    /* inline */ std::size_t GetParent(std::size_t index) const
+    { return m_pages[index / PageSize][index % PageSize].parent; }
+
+    /// \brief  Marks a node as visited for the current query,
+    ///         allocates its page on first touch
+    /* inline */ void Visit(std::size_t index, PriorityType cost, std::size_t parent)
+    {
+        const std::size_t page = index / PageSize;
+        if (m_touched[page] != m_generation)
+        {
+            Touch(page);
+        }
+
+        SEntry& entry    = m_pages[page][index % PageSize];
+        entry.generation = m_generation;
+        entry.cost       = cost;
+        entry.parent     = parent;
+    }
+
+    /// \brief  Returns the size of the state of a visited node
+    static constexpr std::size_t GetEntrySize()
+    { return sizeof(SEntry); }
+
+    /// \brief  Returns the number of bytes used by the page table and the pages
+    /* inline */ std::size_t GetMemoryUsage() const
+    {
+        return m_pages.capacity()   * sizeof(TTPage)
+             + m_touched.capacity() * sizeof(std::uint32_t)
+             + m_used.capacity()    * sizeof(std::size_t)
+             + m_spare.capacity()   * sizeof(TTPage)
+             + (m_used.size() + m_spare.size()) * PageSize * sizeof(SEntry);
+    }
+
+private:
+
+    /// \brief  Everything a relaxation reads or writes
+    ///         is kept together on the same cache line
+    struct SEntry
+    {
+        std::uint32_t generation = 0; ///< The query that wrote the entry
+        PriorityType  cost       = 0; ///< The cost so far
+        std::size_t   parent     = 0; ///< The index of the node we came from
+    };
+
+    using TTEntryAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<SEntry>;
+    using TTPage           = std::vector<SEntry, TTEntryAllocator>;
+
+    /// \brief  Stamps a page with the current query, gives it a spare
+    ///         page or allocates one if needed
+    void Touch(std::size_t page)
+    {
+        if (m_pages[page].empty())
+        {
+            if (m_spare.empty())
+            {
+                m_pages[page].resize(PageSize);
+            }
+            else
+            {
+                m_pages[page].swap(m_spare.back());
+                m_spare.pop_back();
+            }
+
+            m_used.push_back(page);
+        }
+
+        m_touched[page] = m_generation;
+    }
+
+    /// \brief  Clears the stamps of a page
+    static void Reset(TTPage& page)
+    {
+        for (SEntry& entry : page)
+            entry.generation = 0;
+    }
+
+    TTEntryAllocator           m_allocator;      ///< The allocator of the pages
+    std::uint32_t              m_generation = 0; ///< The current query
+    std::vector<TTPage>        m_pages;          ///< One page per PageSize nodes, empty until touched
+    std::vector<std::uint32_t> m_touched;        ///< The last query that touched each page
+    std::vector<std::size_t>   m_used;           ///< The pages in the table
+    std::vector<TTPage>        m_spare;          ///< The recycled pages
+};
+
+/// \brief  Selects the entries of the searches on a graph,
+///         dense by default, graphs too large for them specialize it
+/// \tparam Graph        The graph class
+/// \tparam PriorityType The type of the priority
+/// \tparam Allocator    The allocator of the search state
+template <typename Graph, typename PriorityType, typename Allocator>
+struct TGraphEntries
+{
+    using TTEntries = TDenseEntries<PriorityType, Allocator>;
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_SEARCH_ENTRIES_HPP
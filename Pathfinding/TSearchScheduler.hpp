@@ -0,0 +1,353 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TSearchScheduler.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_SEARCH_SCHEDULER_HPP
+#define PATHFINDING_T_SEARCH_SCHEDULER_HPP
+
+#include <deque>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+
+#include "TResumableSearch.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TSearchScheduler
+/// \brief  Shares a per tick budget between many resumable searches
+///
+///         Pending searches are stepped round robin : each one gets an
+///         equal share of what is left of the budget, at least a minimum
+///         slice so that a large number of searches still progresses.
+///         The order carries over from one tick to the next, the searches
+///         left out when a budget runs out are stepped first next time.
+///
+///         A search state spans the whole graph, so only a bounded number
+///         of searches are active at once and hold one of the pooled
+///         searches. The other submitted searches wait in order for a free
+///         one. A completed search copies its path into its ticket and
+///         gives its state back to the pool : the memory grows with the
+///         number of active searches, not with the number of tickets.
+///
+///         A ticket stays valid until it is released, then it is reused
+///         by a later Submit.
+///
+/// \tparam Search The resumable search (see TResumableSearch)
+template <typename Search>
+class TSearchScheduler
+{
+public:
+
+    using TTNode   = typename Search::TTNode;
+    using TTGraph  = typename Search::TTGraph;
+    using TTClock  = std::chrono::steady_clock;
+    using TTTicket = std::size_t;
+
+    /// \brief  Creates an empty scheduler
+    /// \param  minSlice The smallest number of expansions given to a search
+    /// \param  heuristic The heuristic given to the searches
+    /// \param  maxActive The number of searches stepped at once, i.e. the
+    ///         number of search states allocated
+    explicit TSearchScheduler(std::size_t minSlice = 64,
+                              const typename Search::TTHeuristic& heuristic = typename Search::TTHeuristic(),
+                              std::size_t maxActive = 16)
+    : m_min_slice (std::max<std::size_t>(1, minSlice))
+    , m_max_active(std::max<std::size_t>(1, maxActive))
+    , m_heuristic (heuristic)
+    { /* None */ }
+
+    /// \brief  Queues a new search, no node is expanded yet
+    /// \param  graph The graph, must outlive the search
+    /// \param  start The start node
+    /// \param  end The end node
+    /// \return The ticket of the search
+    TTTicket Submit(const TTGraph& graph, const TTNode& start, const TTNode& end)
+    {
+        TTTicket ticket;
+        if (!m_free_tickets.empty())
+        {
+            ticket = m_free_tickets.back();
+            m_free_tickets.pop_back();
+        }
+        else
+        {
+            ticket = m_tickets.size();
+            m_tickets.emplace_back();
+        }
+
+        STicket& entry = m_tickets[ticket];
+        entry.graph  = &graph;
+        entry.start  = start;
+        entry.end    = end;
+        entry.search = NONE;
+        entry.status = Search::IN_PROGRESS;
+        entry.path.clear();
+
+        m_waiting.push_back(ticket);
+        Activate();
+
+        return ticket;
+    }
+
+    /// \brief  Steps the pending searches within a number of expansions
+    /// \param  budget The number of expansions shared by all searches
+    /// \return The number of expanded nodes
+    std::size_t Tick(std::size_t budget)
+    {
+        std::size_t spent = 0;
+
+        while (spent < budget && !m_pending.empty())
+        {
+            const std::size_t share = std::min(budget - spent, std::max(m_min_slice, (budget - spent) / m_pending.size()));
+
+            Search&           search = *m_searches[m_tickets[m_pending.front()].search];
+            const std::size_t before = search.GetExpandedCount();
+
+            search.Step(share);
+            spent += search.GetExpandedCount() - before;
+
+            Rotate(search);
+        }
+
+        return spent;
+    }
+
+    /// \brief  Steps the pending searches within a duration, the searches
+    ///         read the clock every few expansions so the tick may run a bit over
+    /// \param  budget The duration shared by all searches
+    /// \return The number of expanded nodes
+    std::size_t TickFor(std::chrono::microseconds budget)
+    {
+        const TTClock::time_point deadline = TTClock::now() + budget;
+        std::size_t               spent    = 0;
+
+        while (!m_pending.empty())
+        {
+            const TTClock::time_point now = TTClock::now();
+            if (now >= deadline)
+                break;
+
+            const auto left  = std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+            const auto share = std::max<std::chrono::microseconds>(left / m_pending.size(), std::chrono::microseconds(1));
+
+            Search&           search = *m_searches[m_tickets[m_pending.front()].search];
+            const std::size_t before = search.GetExpandedCount();
+
+            search.StepFor(share);
+            spent += search.GetExpandedCount() - before;
+
+            Rotate(search);
+        }
+
+        return spent;
+    }
+
+    /// \brief  Drops a search, its ticket may be returned by a later Submit
+    /// \param  ticket The ticket of the search
+    void Release(TTTicket ticket)
+    {
+        STicket& entry = m_tickets[ticket];
+
+        auto pending = std::find(m_pending.begin(), m_pending.end(), ticket);
+        if (pending != m_pending.end())
+            m_pending.erase(pending);
+
+        auto waiting = std::find(m_waiting.begin(), m_waiting.end(), ticket);
+        if (waiting != m_waiting.end())
+            m_waiting.erase(waiting);
+
+        if (entry.search != NONE)
+        {
+            m_free_searches.push_back(entry.search);
+            entry.search = NONE;
+        }
+
+        entry.status = Search::IDLE;
+        entry.path.clear();
+        m_free_tickets.push_back(ticket);
+
+        Activate();
+    }
+
+    /// \brief  Returns the path once found
+    /// \param  ticket The ticket of the search
+    /// \param  path The vector to store the result (in reverse order)
+    /// \return false if the search is not FOUND
+    bool GetPath(TTTicket ticket, std::vector<TTNode>& path) const
+    {
+        const STicket& entry = m_tickets[ticket];
+        if (entry.status != Search::FOUND)
+            return false;
+
+        path.insert(path.end(), entry.path.begin(), entry.path.end());
+        return true;
+    }
+
+    /// \brief  Returns the path to the expanded node closest to the end
+    ///         node (see TResumableSearch::GetPartialPath)
+    /// \param  ticket The ticket of the search
+    /// \param  path The vector to store the result (in reverse order)
+    /// \return false if the search has nothing expanded, waiting ones included
+    bool GetPartialPath(TTTicket ticket, std::vector<TTNode>& path) const
+    {
+        const STicket& entry = m_tickets[ticket];
+        if (entry.search != NONE)
+            return m_searches[entry.search]->GetPartialPath(path);
+
+        if (entry.path.empty())
+            return false;
+
+        path.insert(path.end(), entry.path.begin(), entry.path.end());
+        return true;
+    }
+
+    /// \brief  Returns the status of a search, IN_PROGRESS while it waits
+    /// \param  ticket The ticket of the search
+    typename Search::EStatus GetStatus(TTTicket ticket) const
+    {
+        const STicket& entry = m_tickets[ticket];
+        return entry.search != NONE ? m_searches[entry.search]->GetStatus() : entry.status;
+    }
+
+    /// \brief  Returns the number of searches still in progress, waiting ones included
+    std::size_t GetPendingCount() const
+    { return m_pending.size() + m_waiting.size(); }
+
+    /// \brief  Returns the number of bytes used by the pooled search states
+    ///         and the paths kept in the tickets
+    std::size_t GetMemoryUsage() const
+    {
+        std::size_t usage = 0;
+        for (const std::unique_ptr<Search>& search : m_searches)
+            usage += search->GetMemoryUsage();
+
+        for (const STicket& entry : m_tickets)
+            usage += entry.path.capacity() * sizeof(TTNode);
+
+        return usage;
+    }
+
+private:
+
+    /// \brief  The search of a ticket without a pooled search
+    static constexpr std::size_t NONE = static_cast<std::size_t>(-1);
+
+    /// \brief  A submitted search
+    struct STicket
+    {
+        const TTGraph*           graph  = nullptr;       ///< The searched graph
+        TTNode                   start;                  ///< The start node
+        TTNode                   end;                    ///< The end node
+        std::size_t              search = NONE;          ///< The pooled search while active
+        typename Search::EStatus status = Search::IDLE;  ///< The status once inactive
+        std::vector<TTNode>      path;                   ///< The path once complete
+    };
+
+    /// \brief  Gives the free pooled searches to the waiting tickets, in order
+    ///         The searches complete at once are closed before the next one
+    void Activate()
+    {
+        while (!m_waiting.empty())
+        {
+            std::size_t index;
+            if (!m_free_searches.empty())
+            {
+                index = m_free_searches.back();
+                m_free_searches.pop_back();
+            }
+            else if (m_searches.size() < m_max_active)
+            {
+                index = m_searches.size();
+                m_searches.emplace_back(new Search(m_heuristic));
+            }
+            else
+            {
+                break;
+            }
+
+            const TTTicket ticket = m_waiting.front();
+            m_waiting.pop_front();
+
+            STicket& entry = m_tickets[ticket];
+            entry.search   = index;
+            m_searches[index]->Initialize(*entry.graph, entry.start, entry.end);
+
+            if (m_searches[index]->GetStatus() == Search::IN_PROGRESS)
+                m_pending.push_back(ticket);
+            else
+                Complete(ticket);
+        }
+    }
+
+    /// \brief  Copies the path of a completed search into its ticket
+    ///         and gives the search back to the pool
+    void Complete(TTTicket ticket)
+    {
+        STicket& entry  = m_tickets[ticket];
+        Search&  search = *m_searches[entry.search];
+
+        entry.status = search.GetStatus();
+        entry.path.clear();
+        search.GetPartialPath(entry.path);
+
+        m_free_searches.push_back(entry.search);
+        entry.search = NONE;
+    }
+
+    /// \brief  Moves the front search to the back, or completes it
+    void Rotate(const Search& search)
+    {
+        const TTTicket ticket = m_pending.front();
+        m_pending.pop_front();
+
+        if (search.GetStatus() == Search::IN_PROGRESS)
+        {
+            m_pending.push_back(ticket);
+        }
+        else
+        {
+            Complete(ticket);
+            Activate();
+        }
+    }
+
+    std::size_t                          m_min_slice;     ///< The smallest share of a search
+    std::size_t                          m_max_active;    ///< The number of pooled searches
+    typename Search::TTHeuristic         m_heuristic;     ///< The heuristic given to the searches
+    std::vector<std::unique_ptr<Search>> m_searches;      ///< The pooled searches
+    std::vector<std::size_t>             m_free_searches; ///< The pooled searches without a ticket
+    std::vector<STicket>                 m_tickets;       ///< All submitted searches, indexed by ticket
+    std::vector<TTTicket>                m_free_tickets;  ///< The released tickets
+    std::deque<TTTicket>                 m_pending;       ///< The active searches, in stepping order
+    std::deque<TTTicket>                 m_waiting;       ///< The searches waiting for a pooled search
+};
+
+template <typename Search>
+constexpr std::size_t TSearchScheduler<Search>::NONE;
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_SEARCH_SCHEDULER_HPP
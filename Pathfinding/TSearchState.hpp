@@ -0,0 +1,154 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TSearchState.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_SEARCH_STATE_HPP
+#define PATHFINDING_T_SEARCH_STATE_HPP
+
+#include <memory>
+#include <vector>
+#include <cstdint> ///< std::uint32_t
+#include <cstdlib> ///< std::size_t
+
+#include "TNode.hpp"
+#include "TFrontier.hpp"
+#include "TSearchStats.hpp"
+#include "TSearchEntries.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TSearchState
+/// \brief  Stores the scratch data of a search : the visited nodes
+///         indexed by node (see Graph::GetNodeIndex), the open list,
+///         the neighbors buffer and the statistics
+///
+///         The visited nodes are kept by the entries policy, one flat
+///         array by default. Starting a new query clears nothing, the
+///         entries are stamped with the generation of their query.
+///
+/// \tparam CoordinateType The type of the coordinates
+/// \tparam PriorityType   The type of the priority
+/// \tparam Frontier       The open list policy (see TFrontier.hpp)
+/// \tparam Stats          The statistics policy (see TSearchStats.hpp)
+/// \tparam Allocator      The allocator of the node entries, given to the frontier too
+///                        (see TArenaAllocator.hpp)
+/// \tparam Entries        The storage of the visited nodes (see TSearchEntries.hpp)
+template <typename CoordinateType, typename PriorityType,
+          typename Frontier  = TDefaultFrontier<CoordinateType, PriorityType>,
+          typename Stats     = TNoSearchStats  <CoordinateType, PriorityType>,
+          typename Allocator = std::allocator  <TNode<CoordinateType, PriorityType>>,
+          typename Entries   = TDenseEntries   <PriorityType, Allocator>>
+class TSearchState
+{
+public:
+
+    using TTNode      = TNode<CoordinateType, PriorityType>;
+    using TTFrontier  = Frontier;
+    using TTStats     = Stats;
+    using TTAllocator = Allocator;
+    using TTEntries   = Entries;
+
+    /// \brief  Creates an empty state
+    /// \param  allocator The allocator of the node entries and of the frontier
+    explicit TSearchState(const Allocator& allocator = Allocator())
+    : m_entries (allocator)
+    , m_frontier(allocator)
+    {
+        // The graphs fill a std::vector, sized once for 8 way grids
+        m_neighbors.reserve(8);
+    }
+
+
+    /// \brief  Prepares the state for a new query on a graph of nodeCount nodes
+    /// \param  nodeCount The number of nodes of the graph
+    /* inline */ void BeginQuery(std::size_t nodeCount)
+    {
+        m_entries.BeginQuery(nodeCount);
+
+        m_frontier.Clear();
+        m_neighbors.clear();
+    }
+
+    /// \brief  Tells if the node has been reached during the current query
+    /// \param  index The index of the node
+    /// \return True or false
+    /* inline */ bool IsVisited(std::size_t index) const
+    { return m_entries.IsVisited(index); }
+
+    /// \brief  Returns the cost so far of a visited node
+    /// \param  index The index of the node
+    /// \return The cost from the start node
+    /* inline */ PriorityType GetCost(std::size_t index) const
+    { return m_entries.GetCost(index); }
+
+    /// \brief  Returns the index of the node we came from
+    /// \param  index The index of a visited node
+    /// \return The index of its parent
+    /* inline */ std::size_t GetParent(std::size_t index) const
+    { return m_entries.GetParent(index); }
+
+    /// \brief  Marks a node as visited for the current query
+    /// \param  index The index of the node
+    /// \param  cost The cost from the start node
+    /// \param  parent The index of the node we came from
+    /* inline */ void Visit(std::size_t index, PriorityType cost, std::size_t parent)
+    { m_entries.Visit(index, cost, parent); }
+
+    /// \brief  Returns the open list
+    /// \return A reference on the frontier
+    /* inline */ Frontier& GetFrontier()
+    { return m_frontier; }
+
+    /// \brief  Returns the neighbors scratch buffer
+    /// \return A reference on the neighbors buffer
+    /* inline */ std::vector<TTNode>& GetNeighbors()
+    { return m_neighbors; }
+
+    /// \brief  Returns the statistics of the queries
+    /// \return A reference on the statistics
+    /* inline */ Stats& GetStats()
+    { return m_stats; }
+
+    /* inline */ const Stats& GetStats() const
+    { return m_stats; }
+
+    /// \brief  Returns the size of the state of a visited node
+    static constexpr std::size_t GetEntrySize()
+    { return Entries::GetEntrySize(); }
+
+    /// \brief  Returns the number of bytes used by the node entries
+    ///         and the neighbors buffer, the frontier aside
+    /* inline */ std::size_t GetMemoryUsage() const
+    { return m_entries.GetMemoryUsage() + m_neighbors.capacity() * sizeof(TTNode); }
+
+private:
+
+    Entries             m_entries;   ///< The visited nodes
+    Frontier            m_frontier;  ///< The open list
+    std::vector<TTNode> m_neighbors; ///< The neighbors of the expanded node
+    Stats               m_stats;     ///< The statistics of the queries
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_SEARCH_STATE_HPP
@@ -0,0 +1,240 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TSearchStats.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_SEARCH_STATS_HPP
+#define PATHFINDING_T_SEARCH_STATS_HPP
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <cstdlib> ///< std::size_t
+#include <algorithm>
+
+#include "TNode.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TNoSearchStats
+/// \brief  Statistics policy that records nothing, every hook is empty
+///         and compiled out. The default of the searches.
+/// \tparam CoordinateType The type of the coordinates
+/// \tparam PriorityType   The type of the priority
+template <typename CoordinateType, typename PriorityType>
+class TNoSearchStats
+{
+public:
+
+    using TTNode = TNode<CoordinateType, PriorityType>;
+
+    /// \brief  Called before the query, entrySize is the state size of a visited node
+    /* inline */ void BeginQuery(std::size_t /* entrySize */)
+    { /* None */ }
+
+    /// \brief  Called after the query
+    /* inline */ void EndQuery(bool /* found */)
+    { /* None */ }
+
+    /// \brief  Called when a node is added to the open list
+    /* inline */ void OnPush(const TTNode& /* node */)
+    { /* None */ }
+
+    /// \brief  Called when a node is removed from the open list
+    /* inline */ void OnPop(const TTNode& /* node */)
+    { /* None */ }
+
+    /// \brief  Called when a popped node was already expanded with a better cost
+    /* inline */ void OnStale(const TTNode& /* node */)
+    { /* None */ }
+
+    /// \brief  Called when a node is reached, reopened if it was already reached
+    /* inline */ void OnVisit(std::size_t /* index */, bool /* reopened */)
+    { /* None */ }
+
+    /// \brief  Called when the neighbors of a node are expanded
+    /* inline */ void OnExpand(const TTNode& /* node */, std::size_t /* index */)
+    { /* None */ }
+};
+
+/// \class  TSearchStats
+/// \brief  Statistics policy that records the counters of the last query
+///
+///         Peak memory counts the open list entries at their peak and
+///         the state entries written by the query, the flat state itself
+///         is allocated once for all queries.
+///
+/// \tparam CoordinateType The type of the coordinates
+/// \tparam PriorityType   The type of the priority
+template <typename CoordinateType, typename PriorityType>
+class TSearchStats
+{
+public:
+
+    using TTNode  = TNode<CoordinateType, PriorityType>;
+    using TTClock = std::chrono::steady_clock;
+
+    /// \brief  Called before the query, resets the counters
+    /// \param  entrySize The state size of a visited node
+    /* inline */ void BeginQuery(std::size_t entrySize)
+    {
+        m_entry_size    = entrySize;
+        m_expanded      = 0;
+        m_pushes        = 0;
+        m_duplicates    = 0;
+        m_stale         = 0;
+        m_visited       = 0;
+        m_frontier_size = 0;
+        m_peak_frontier = 0;
+        m_found         = false;
+        m_start         = TTClock::now();
+    }
+
+    /// \brief  Called after the query
+    /// \param  found Tells if a path was found
+    /* inline */ void EndQuery(bool found)
+    {
+        m_found     = found;
+        m_wall_time = std::chrono::duration<double>(TTClock::now() - m_start).count();
+    }
+
+    /// \brief  Called when a node is added to the open list
+    /* inline */ void OnPush(const TTNode& /* node */)
+    {
+        ++m_pushes;
+        m_peak_frontier = std::max(m_peak_frontier, ++m_frontier_size);
+    }
+
+    /// \brief  Called when a node is removed from the open list
+    /* inline */ void OnPop(const TTNode& /* node */)
+    { --m_frontier_size; }
+
+    /// \brief  Called when a popped node was already expanded with a better cost
+    /* inline */ void OnStale(const TTNode& /* node */)
+    { ++m_stale; }
+
+    /// \brief  Called when a node is reached, reopened if it was already reached
+    /* inline */ void OnVisit(std::size_t /* index */, bool reopened)
+    {
+        if (reopened) ++m_duplicates;
+        else          ++m_visited;
+    }
+
+    /// \brief  Called when the neighbors of a node are expanded
+    /* inline */ void OnExpand(const TTNode& /* node */, std::size_t /* index */)
+    { ++m_expanded; }
+
+    /// \brief  Returns the number of expanded nodes
+    /* inline */ std::size_t GetExpandedCount() const
+    { return m_expanded; }
+
+    /// \brief  Returns the number of nodes added to the open list
+    /* inline */ std::size_t GetPushCount() const
+    { return m_pushes; }
+
+    /// \brief  Returns the number of nodes pushed again with a better cost
+    /* inline */ std::size_t GetDuplicateCount() const
+    { return m_duplicates; }
+
+    /// \brief  Returns the number of popped duplicates that were skipped
+    /* inline */ std::size_t GetStaleCount() const
+    { return m_stale; }
+
+    /// \brief  Returns the number of distinct nodes reached
+    /* inline */ std::size_t GetVisitedCount() const
+    { return m_visited; }
+
+    /// \brief  Returns the largest number of nodes in the open list
+    /* inline */ std::size_t GetPeakFrontier() const
+    { return m_peak_frontier; }
+
+    /// \brief  Returns the bytes of open list and state entries used by the query
+    /* inline */ std::size_t GetPeakMemory() const
+    { return m_peak_frontier * sizeof(TTNode) + m_visited * m_entry_size; }
+
+    /// \brief  Returns the duration of the query in seconds
+    /* inline */ double GetWallTime() const
+    { return m_wall_time; }
+
+    /// \brief  Tells if the query found a path
+    /* inline */ bool IsFound() const
+    { return m_found; }
+
+private:
+
+    std::size_t         m_entry_size    = 0;     ///< The state size of a visited node
+    std::size_t         m_expanded      = 0;     ///< The expanded nodes
+    std::size_t         m_pushes        = 0;     ///< The pushed nodes
+    std::size_t         m_duplicates    = 0;     ///< The nodes pushed again
+    std::size_t         m_stale         = 0;     ///< The skipped pops
+    std::size_t         m_visited       = 0;     ///< The distinct reached nodes
+    std::size_t         m_frontier_size = 0;     ///< The current size of the open list
+    std::size_t         m_peak_frontier = 0;     ///< The peak size of the open list
+    bool                m_found         = false; ///< The result of the query
+    double              m_wall_time     = 0.0;   ///< The duration of the query
+    TTClock::time_point m_start;                 ///< The start of the query
+};
+
+/// \class  THeatMapStats
+/// \brief  Statistics policy that also counts the expansions of each
+///         node over all queries, to draw a heat map of the searches
+/// \tparam CoordinateType The type of the coordinates
+/// \tparam PriorityType   The type of the priority
+template <typename CoordinateType, typename PriorityType>
+class THeatMapStats : public TSearchStats<CoordinateType, PriorityType>
+{
+public:
+
+    using TTNode  = TNode<CoordinateType, PriorityType>;
+    using TTStats = TSearchStats<CoordinateType, PriorityType>;
+
+    /// \brief  Called when the neighbors of a node are expanded
+    /* inline */ void OnExpand(const TTNode& node, std::size_t index)
+    {
+        TTStats::OnExpand(node, index);
+
+        if (index >= m_heat.size())
+            m_heat.resize(index + 1, 0);
+
+        ++m_heat[index];
+    }
+
+    /// \brief  Returns the number of expansions of a node (see Graph::GetNodeIndex)
+    /* inline */ std::uint32_t GetHeat(std::size_t index) const
+    { return index < m_heat.size() ? m_heat[index] : 0; }
+
+    /// \brief  Returns the expansions of all nodes, indexed by node
+    /* inline */ const std::vector<std::uint32_t>& GetHeatMap() const
+    { return m_heat; }
+
+    /// \brief  Sets all expansion counts to zero
+    /* inline */ void ClearHeat()
+    { m_heat.clear(); }
+
+private:
+
+    std::vector<std::uint32_t> m_heat; ///< The expansions of each node
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_SEARCH_STATS_HPP
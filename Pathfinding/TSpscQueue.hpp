@@ -0,0 +1,107 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TSpscQueue.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_SPSC_QUEUE_HPP
+#define PATHFINDING_T_SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <vector>
+#include <cstdlib>
+
+/// \namespace nav
+namespace nav
+{
+
+/// \class  TSpscQueue
+/// \brief  Bounded lock free queue between one producer and one consumer
+///
+///         A ring of slots with a read and a write index, each one
+///         written by a single thread. The indexes sit on their own
+///         cache lines so that both sides don't invalidate each other.
+///
+/// \tparam T The type of the values, must be copyable
+template <typename T>
+class TSpscQueue
+{
+public:
+
+    /// \brief  Creates an empty queue
+    /// \param  capacity The number of slots, rounded up to a power of two
+    explicit TSpscQueue(std::size_t capacity = 1024)
+    {
+        std::size_t size = 2;
+        while (size < capacity)
+            size *= 2;
+
+        m_slots.resize(size);
+        m_mask = size - 1;
+    }
+
+    TSpscQueue(const TSpscQueue&)            = delete;
+    TSpscQueue& operator=(const TSpscQueue&) = delete;
+
+    /// \brief  Adds a value, called by the producer only
+    /// \param  value The value to add
+    /// \return false if the queue is full
+    /* inline */ bool TryPush(const T& value)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) > m_mask)
+            return false;
+
+        m_slots[tail & m_mask] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// \brief  Removes the oldest value, called by the consumer only
+    /// \param  value The removed value
+    /// \return false if the queue is empty
+    /* inline */ bool TryPop(T& value)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire))
+            return false;
+
+        value = m_slots[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// \brief  Tells if the queue looks empty, exact for the consumer only
+    /* inline */ bool IsEmpty() const
+    { return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire); }
+
+private:
+
+    std::vector<T>           m_slots;           ///< The ring
+    std::size_t              m_mask = 0;        ///< The number of slots minus one
+    char                     m_padding_0[64];   ///< Keeps the read index on its own line
+    std::atomic<std::size_t> m_head { 0 };      ///< The next slot to read, written by the consumer
+    char                     m_padding_1[64];   ///< Keeps the write index on its own line
+    std::atomic<std::size_t> m_tail { 0 };      ///< The next slot to write, written by the producer
+    char                     m_padding_2[64];   ///< Keeps the next object away
+};
+
+} // !namespace nav
+
+#endif // PATHFINDING_T_SPSC_QUEUE_HPP
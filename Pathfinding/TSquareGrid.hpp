@@ -24,9 +24,14 @@
 #define PATHFINDING_T_SQUARE_GRID_HPP
 
 #include <vector>
+#include <cstdint>
+#include <cstdlib>
 #include <algorithm>
 
 #include "TNode.hpp"
+#include "TGridLayout.hpp"
+#include "TMoveRules.hpp"
+#include "TMovePolicy.hpp"
 
 /// \namespace nav
 namespace nav
@@ -34,49 +39,167 @@ namespace nav
 
 /// \class  TSquareGrid
 /// \brief  Stores a 2D square grid
+///
+///         Each node has a terrain cost, the cost to enter it, stored
+///         on one byte beside the nodes. It defaults to 1 and can't be 0
+///         so that the heuristics stay admissible.
+///
+///         Nodes are stored in the order given by the layout policy,
+///         node indices follow it (see GetNodeIndex). Layouts that pad
+///         the grid add nodes without neighbors, GetNodeCount counts them.
+///
 /// \tparam CoordinateType The type of the coordinate system
 /// \tparam PriorityType   The type of the priority
-template <typename CoordinateType, typename PriorityType>
+/// \tparam Moves          The move policy (see TMovePolicy.hpp)
+/// \tparam Layout         The storage order (see TGridLayout.hpp)
+template <typename CoordinateType, typename PriorityType, typename Moves = TFourWayMoves<PriorityType>, typename Layout = TRowMajorLayout>
 class TSquareGrid
 {
 public:
 
-    using TTNode = TNode<CoordinateType, PriorityType>;
+    using TTNode   = TNode<CoordinateType, PriorityType>;
+    using TTMoves  = Moves;
+    using TTLayout = Layout;
 
     /// \brief  Initializes a grid width x height
     /// \param  width The width of the grid
     /// \param  height The height of the grid
     void Initialize(CoordinateType width, CoordinateType height);
 
-    /// \brief  Puts into the current node neighbors all direct neighbors
+    /// \brief  Puts into the current node neighbors all direct neighbors,
+    ///         followed by the diagonal ones if the move policy allows them
     /// \param  current The node to check
     /// \param  neighbors The vector of neighbors
     inline void GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const;
 
+    /// \brief  Returns the cost to move from a node to one of its neighbors
+    /// \param  from The current node
+    /// \param  to The neighbor
+    /// \return The cost of the move
+    inline PriorityType GetCost(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Sets the terrain cost of a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  cost The cost to enter the node, at least 1
+    inline void SetNodeCost(CoordinateType x, CoordinateType y, unsigned char cost);
+
+    /// \brief  Returns the terrain cost of a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \return The cost to enter the node
+    inline unsigned char GetNodeCost(CoordinateType x, CoordinateType y) const;
+
     /// \brief  Returns a read only reference on a node
     /// \param  x The X coordinate of the node
     /// \param  y The Y coordinate of the node
     /// \return A reference on a node
     inline const TTNode & GetNode (CoordinateType x, CoordinateType y) const;
 
+    /// \brief  Returns a read only reference on a node from its index
+    /// \param  index The index of the node (see GetNodeIndex)
+    /// \return A reference on a node
+    inline const TTNode & GetNodeAt(std::size_t index) const;
+
+    /// \brief  Returns the index of a node in the grid (see the layout policy)
+    /// \param  node The node
+    /// \return The index of the node
+    inline std::size_t GetNodeIndex(const TTNode& node) const;
+
+    /// \brief  Returns the number of nodes of the grid, padding included
+    /// \return The number of nodes
+    inline std::size_t GetNodeCount() const;
+
+    /// \brief  Returns the width of the grid
+    /// \return The width of the grid
+    inline CoordinateType GetWidth() const;
+
+    /// \brief  Returns the height of the grid
+    /// \return The height of the grid
+    inline CoordinateType GetHeight() const;
+
     /// \brief  Sets the neighbors of a node
+    ///         and updates the connected components
     /// \param  x The X coordinate of the node
     /// \param  y The Y coordinate of the node
     /// \param  flag The flag to apply
     inline void SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag);
 
+    /// \brief  Tells if a path may exist between two nodes,
+    ///         i.e. if they are in the same connected component
+    /// \param  from The first node
+    /// \param  to The second node
+    /// \return True or false
+    inline bool IsReachable(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Returns the connected component label of a node
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \return The label of the component
+    inline std::uint32_t GetComponent(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns the edit epoch, bumped by every edit of the grid
+    /// \return The current epoch
+    inline std::uint32_t GetEpoch() const;
+
+    /// \brief  Returns the epoch of the last edit that may change
+    ///         the moves from or to a node
+    /// \param  index The index of the node
+    /// \return The epoch of the node
+    inline std::uint32_t GetNodeEpoch(std::size_t index) const;
+
     /// \brief  Tells if the node is valid or node
     /// \param  x The X coordinate of the node
     /// \param  y The Y coordinate of the node
     /// \return True or false
     inline bool IsValidNode(CoordinateType x, CoordinateType y) const;
 
+    /// \brief  Returns the number of bytes used by the grid
+    /// \return The size of the grid and of its buffers
+    inline std::size_t GetMemoryUsage() const;
+
 private:
 
+    using TTMoveRules = TMoveRules<TTNode, Moves>;
+
+    /// \brief  Bumps the epoch and stamps the nodes whose moves may change
+    /// \param  x The X coordinate of the edited node
+    /// \param  y The Y coordinate of the edited node
+    /// \param  radius 1 to stamp the 8 nodes around too, 0 otherwise
+    inline void Touch(CoordinateType x, CoordinateType y, int radius);
+
+    /// \brief  Merges the components of two nodes after an edge was added
+    /// \param  from The index of the first node
+    /// \param  to The index of the second node
+    void Connect(std::size_t from, std::size_t to);
+
+    /// \brief  Splits the component of two nodes if they are no longer linked
+    /// \param  from The index of the first node
+    /// \param  to The index of the second node
+    void Disconnect(std::size_t from, std::size_t to);
+
+    /// \brief  Gives a new label to the component of a node
+    /// \param  from The index of the node
+    /// \param  label The new label
+    void Relabel(std::size_t from, std::uint32_t label);
+
     CoordinateType m_width;  ///< The width of the grid
     CoordinateType m_height; ///< The height of the grid
+    Layout         m_layout; ///< The storage order
+
+    std::vector < TTNode >        m_grid;  ///< The 2D grid
+    std::vector < unsigned char > m_costs; ///< The terrain cost of each node
+
+    std::uint32_t                 m_epoch = 0;   ///< The edit epoch
+    std::vector < std::uint32_t > m_node_epochs; ///< The last epoch touching each node
 
-    std::vector < TTNode >  m_grid; ///< The 2D grid
+    std::vector < std::uint32_t > m_components;      ///< The component label of each node
+    std::vector < std::uint32_t > m_component_sizes; ///< The number of nodes of each label
+    std::vector < std::uint32_t > m_free_labels;     ///< Labels of merged components
+    std::vector < std::uint32_t > m_visited;         ///< Visit stamps used when splitting
+    std::uint32_t                 m_visit_stamp = 0; ///< The last visit stamp
+    std::vector < std::size_t >   m_fill[2];         ///< Flood fill queues
+    std::vector < TTNode >        m_neighbors;       ///< Flood fill neighbors
 };
 
 } // !namespace
@@ -27,105 +27,435 @@ namespace nav
 /// \brief  Initializes a n x m grid
 /// \param  width The width of the grid
 /// \param  height The height of the grid
-template <typename CoordinateType, typename PriorityType>
-void TSquareGrid<CoordinateType, PriorityType>::Initialize(CoordinateType width, CoordinateType height)
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+void TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::Initialize(CoordinateType width, CoordinateType height)
 {
+    m_layout.Initialize(width, height);
+    const std::size_t count = m_layout.GetSize();
+
     // Clear old grid
     m_grid.clear();
+    m_grid.resize(count);
+    m_costs.assign(count, 1);
+
+    // A new grid, everything cached on the previous one is stale
+    ++m_epoch;
+    m_node_epochs.assign(count, m_epoch);
 
     m_width  = width;
     m_height = height;
 
-    m_grid.reserve(m_width * m_height);
-    for(CoordinateType nRow = 0; nRow < m_height; ++nRow)
+    // Padding nodes have no neighbors, they are never reached
+    for(std::size_t nRow = 0; nRow < m_layout.GetPaddedHeight(); ++nRow)
     {
-        for(CoordinateType nCol = 0; nCol < m_width; ++nCol)
+        for(std::size_t nCol = 0; nCol < m_layout.GetPaddedWidth(); ++nCol)
         {
-            m_grid.push_back(TTNode(nCol, nRow));
+            m_grid[m_layout.GetIndex(nCol, nRow)] = TTNode(static_cast<CoordinateType>(nCol), static_cast<CoordinateType>(nRow));
         }
     }
+
+    // Nodes have no neighbors yet, each one is its own component
+    m_components.resize(m_grid.size());
+    m_component_sizes.assign(m_grid.size(), 1);
+    m_free_labels.clear();
+    m_visited.assign(m_grid.size(), 0);
+    m_visit_stamp = 0;
+
+    for (std::size_t index = 0; index < m_grid.size(); ++index)
+    {
+        m_components[index] = static_cast<std::uint32_t>(index);
+    }
 }
 
-/// \brief  Puts into the current node neighbors all direct neighbors
+/// \brief  Puts into the current node neighbors all direct neighbors,
+///         followed by the diagonal ones if the move policy allows them
 /// \param  current The node to check
 /// \param  neighbors The vector of neighbors
-template <typename CoordinateType, typename PriorityType>
-void TSquareGrid<CoordinateType, PriorityType>::GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+void TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const
 {
-    // Getting neighbors mask
-    CoordinateType x = current.X();
-    CoordinateType y = current.Y();
-    unsigned char neighborFlags = current.GetNeighborFlags();
+    TTMoveRules::GetNeighbors(current.X(), current.Y(), current.GetNeighborFlags(),
+        [this](int x, int y) -> unsigned char
+        { return IsValidNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y)) ? GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y)).GetNeighborFlags() : 0; },
+        [this](int x, int y, unsigned char /* flags */) -> const TTNode&
+        { return GetNode(static_cast<CoordinateType>(x), static_cast<CoordinateType>(y)); },
+        neighbors);
+}
 
-    for(unsigned char nShift = 0; nShift < 4; ++nShift)
-    {
-        unsigned char currentMask = static_cast<unsigned char>(1 << nShift);
-        if(neighborFlags & currentMask)
-        {
-            // There is a neighbor in this direction
-            switch(currentMask)
-            {
-                case TTNode::NORTH:
-                    if(IsValidNode(x, y - 1) && (GetNode(x, y - 1).GetNeighborFlags() & TTNode::SOUTH))
-                        neighbors.push_back(GetNode(x, y - 1));
-                    break;
-
-                case TTNode::EAST:
-                    if(IsValidNode(x + 1, y) && (GetNode(x + 1, y).GetNeighborFlags() & TTNode::WEST))
-                        neighbors.push_back(GetNode(x + 1, y    ));
-                    break;
-
-                case TTNode::SOUTH:
-                    if(IsValidNode(x, y + 1) && (GetNode(x, y + 1).GetNeighborFlags() & TTNode::NORTH))
-                        neighbors.push_back(GetNode(x, y + 1));
-                    break;
-
-                case TTNode::WEST:
-                    if(IsValidNode(x - 1, y) && (GetNode(x - 1, y).GetNeighborFlags() & TTNode::EAST))
-                        neighbors.push_back(GetNode(x - 1, y));
-                    break;
-
-                default: break;
-            }
-        }
-    }
+/// \brief  Returns the cost to move from a node to one of its neighbors
+///         The terrain cost of the neighbor scaled by the move length
+/// \param  from The current node
+/// \param  to The neighbor
+/// \return The cost of the move
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline PriorityType TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetCost(const TTNode& from, const TTNode& to) const
+{
+    const PriorityType cost = m_costs[GetNodeIndex(to)];
 
-    // See with and without
-    // Small optimization for squared grid
-    if ((x + y) % 2 == 0)
-    {
-        std::reverse(neighbors.begin(), neighbors.end());
-    }
+    if (Moves::DIAGONAL && from.X() != to.X() && from.Y() != to.Y())
+        return cost * Moves::DIAGONAL_COST;
+
+    return cost * Moves::STRAIGHT_COST;
+}
+
+/// \brief  Sets the terrain cost of a node
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+/// \param  cost The cost to enter the node, at least 1
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline void TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::SetNodeCost(CoordinateType x, CoordinateType y, unsigned char cost)
+{
+    // A free node would break the admissibility of the heuristics
+    m_costs[m_layout.GetIndex(x, y)] = std::max<unsigned char>(cost, 1);
+    Touch(x, y, 0);
+}
+
+/// \brief  Returns the terrain cost of a node
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+/// \return The cost to enter the node
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline unsigned char TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetNodeCost(CoordinateType x, CoordinateType y) const
+{
+    return m_costs[m_layout.GetIndex(x, y)];
 }
 
 /// \brief  Returns a read only reference on a node
 /// \param  x The X coordinate of the node
 /// \param  y The Y coordinate of the node
 /// \return A read only reference on the wanted node
-template <typename CoordinateType, typename PriorityType>
-inline const TNode<CoordinateType, PriorityType>& TSquareGrid<CoordinateType, PriorityType>::GetNode(CoordinateType x, CoordinateType y) const
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline const TNode<CoordinateType, PriorityType>& TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetNode(CoordinateType x, CoordinateType y) const
 {
-    return m_grid[y * m_width + x];
+    return m_grid[m_layout.GetIndex(x, y)];
 };
 
+/// \brief  Returns a read only reference on a node from its index
+/// \param  index The index of the node (see GetNodeIndex)
+/// \return A read only reference on the wanted node
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline const TNode<CoordinateType, PriorityType>& TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetNodeAt(std::size_t index) const
+{
+    return m_grid[index];
+}
+
+/// \brief  Returns the index of a node in the grid (see the layout policy)
+/// \param  node The node
+/// \return The index of the node
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline std::size_t TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetNodeIndex(const TTNode& node) const
+{
+    return m_layout.GetIndex(node.X(), node.Y());
+}
+
+/// \brief  Returns the number of nodes of the grid
+/// \return The number of nodes
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline std::size_t TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetNodeCount() const
+{
+    return m_grid.size();
+}
+
+/// \brief  Returns the width of the grid
+/// \return The width of the grid
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline CoordinateType TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetWidth() const
+{
+    return m_width;
+}
+
+/// \brief  Returns the height of the grid
+/// \return The height of the grid
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline CoordinateType TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetHeight() const
+{
+    return m_height;
+}
+
 /// \brief  Sets the neighbors of a node
+///         Diagonal moves always have a straight detour,
+///         only straight edges change the components
 /// \param  x The X coordinate of the node
 /// \param  y The Y coordinate of the node
 /// \param  flag The flag to apply
-template <typename CoordinateType, typename PriorityType>
-inline void TSquareGrid<CoordinateType, PriorityType>::SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag)
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline void TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag)
+{
+    static const int           offsets[4][2] = { { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 } };
+    static const unsigned char flags    [4]  = { TTNode::NORTH, TTNode::EAST, TTNode::SOUTH, TTNode::WEST };
+    static const unsigned char opposites[4]  = { TTNode::SOUTH, TTNode::WEST, TTNode::NORTH, TTNode::EAST };
+
+    const std::size_t   index    = m_layout.GetIndex(x, y);
+    const unsigned char previous = m_grid[index].GetNeighborFlags();
+
+    m_grid[index].SetNeighborFlag(flag);
+
+    // The node is the corner of the diagonal moves around it
+    Touch(x, y, 1);
+
+    // The node itself and the ends of its removed edges
+    std::size_t added[4];
+    std::size_t ends [5] = { index };
+    std::size_t added_count = 0;
+    std::size_t end_count   = 1;
+
+    for (int direction = 0; direction < 4; ++direction)
+    {
+        const int nx = x + offsets[direction][0];
+        const int ny = y + offsets[direction][1];
+
+        if (nx < 0 || nx >= m_width || ny < 0 || ny >= m_height)
+            continue;
+
+        const std::size_t neighbor = m_layout.GetIndex(nx, ny);
+        const bool        linked   = (m_grid[neighbor].GetNeighborFlags() & opposites[direction]) != 0;
+        const bool        before   = linked && (previous & flags[direction]);
+        const bool        after    = linked && (flag     & flags[direction]);
+
+        if (after && !before) added[added_count++] = neighbor;
+        if (before && !after) ends [end_count++]   = neighbor;
+    }
+
+    // Splits first, components must match the edges before merging.
+    // Every part of a split component holds one end of a removed edge,
+    // so checking those nodes two by two is enough
+    for (std::size_t n = 1; n < end_count; ++n)
+    {
+        for (std::size_t other = 0; other < n; ++other)
+            Disconnect(ends[other], ends[n]);
+    }
+
+    for (std::size_t n = 0; n < added_count; ++n)
+        Connect(index, added[n]);
+}
+
+/// \brief  Tells if a path may exist between two nodes,
+///         i.e. if they are in the same connected component
+/// \param  from The first node
+/// \param  to The second node
+/// \return True or false
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline bool TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::IsReachable(const TTNode& from, const TTNode& to) const
+{
+    return m_components[GetNodeIndex(from)] == m_components[GetNodeIndex(to)];
+}
+
+/// \brief  Returns the connected component label of a node
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+/// \return The label of the component
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline std::uint32_t TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetComponent(CoordinateType x, CoordinateType y) const
+{
+    return m_components[m_layout.GetIndex(x, y)];
+}
+
+/// \brief  Returns the edit epoch, bumped by every edit of the grid
+/// \return The current epoch
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline std::uint32_t TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetEpoch() const
+{
+    return m_epoch;
+}
+
+/// \brief  Returns the epoch of the last edit that may change
+///         the moves from or to a node
+/// \param  index The index of the node
+/// \return The epoch of the node
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline std::uint32_t TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetNodeEpoch(std::size_t index) const
 {
-    m_grid[y * m_width + x].SetNeighborFlag(flag);
+    return m_node_epochs[index];
+}
+
+/// \brief  Bumps the epoch and stamps the nodes whose moves may change
+/// \param  x The X coordinate of the edited node
+/// \param  y The Y coordinate of the edited node
+/// \param  radius 1 to stamp the 8 nodes around too, 0 otherwise
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline void TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::Touch(CoordinateType x, CoordinateType y, int radius)
+{
+    ++m_epoch;
+
+    for (int ny = y - radius; ny <= y + radius; ++ny)
+    {
+        for (int nx = x - radius; nx <= x + radius; ++nx)
+        {
+            if (nx >= 0 && nx < m_width && ny >= 0 && ny < m_height)
+                m_node_epochs[m_layout.GetIndex(nx, ny)] = m_epoch;
+        }
+    }
+}
+
+/// \brief  Merges the components of two nodes after an edge was added
+///         The smallest component is relabeled
+/// \param  from The index of the first node
+/// \param  to The index of the second node
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+void TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::Connect(std::size_t from, std::size_t to)
+{
+    std::uint32_t kept    = m_components[from];
+    std::uint32_t dropped = m_components[to];
+
+    if (kept == dropped)
+        return;
+
+    if (m_component_sizes[kept] < m_component_sizes[dropped])
+    {
+        std::swap(kept, dropped);
+        std::swap(from, to);
+    }
+
+    Relabel(to, kept);
+
+    m_component_sizes[kept]   += m_component_sizes[dropped];
+    m_component_sizes[dropped] = 0;
+    m_free_labels.push_back(dropped);
+}
+
+/// \brief  Splits the component of two nodes if they are no longer linked
+///
+///         Both sides are flood filled one node at a time. If they meet
+///         the component is unchanged, otherwise the side that runs out
+///         first is the smallest part and is the only one relabeled.
+///
+/// \param  from The index of the first node
+/// \param  to The index of the second node
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+void TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::Disconnect(std::size_t from, std::size_t to)
+{
+    const std::uint32_t label = m_components[from];
+    if (label != m_components[to])
+        return;
+
+    // Two fresh stamps, one per side
+    if (m_visit_stamp > UINT32_MAX - 2)
+    {
+        std::fill(m_visited.begin(), m_visited.end(), 0);
+        m_visit_stamp = 0;
+    }
+
+    const std::uint32_t stamps[2] = { m_visit_stamp + 1, m_visit_stamp + 2 };
+    m_visit_stamp += 2;
+
+    std::size_t heads[2] = { 0, 0 };
+    std::vector<TTNode>& neighbors = m_neighbors;
+
+    m_fill[0].assign(1, from);
+    m_fill[1].assign(1, to);
+    m_visited[from] = stamps[0];
+    m_visited[to]   = stamps[1];
+
+    while (true)
+    {
+        for (int side = 0; side < 2; ++side)
+        {
+            std::vector<std::size_t>& fill = m_fill[side];
+
+            if (heads[side] == fill.size())
+            {
+                // This side is a whole component of its own
+                std::uint32_t new_label;
+                if (m_free_labels.empty())
+                {
+                    new_label = static_cast<std::uint32_t>(m_component_sizes.size());
+                    m_component_sizes.push_back(0);
+                }
+                else
+                {
+                    new_label = m_free_labels.back();
+                    m_free_labels.pop_back();
+                }
+
+                for (std::size_t node : fill)
+                    m_components[node] = new_label;
+
+                m_component_sizes[new_label]  = static_cast<std::uint32_t>(fill.size());
+                m_component_sizes[label]     -= static_cast<std::uint32_t>(fill.size());
+                return;
+            }
+
+            const std::size_t current = fill[heads[side]++];
+
+            neighbors.clear();
+            GetNeighbors(m_grid[current], neighbors);
+
+            for (const TTNode& next : neighbors)
+            {
+                const std::size_t index = GetNodeIndex(next);
+
+                if (m_components[index] != label || m_visited[index] == stamps[side])
+                    continue;
+
+                // Reached the other side, still connected
+                if (m_visited[index] == stamps[1 - side])
+                    return;
+
+                m_visited[index] = stamps[side];
+                fill.push_back(index);
+            }
+        }
+    }
+}
+
+/// \brief  Gives a new label to the component of a node
+/// \param  from The index of the node
+/// \param  label The new label
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+void TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::Relabel(std::size_t from, std::uint32_t label)
+{
+    const std::uint32_t previous = m_components[from];
+    std::vector<std::size_t>& fill      = m_fill[0];
+    std::vector<TTNode>&      neighbors = m_neighbors;
+
+    fill.assign(1, from);
+    m_components[from] = label;
+
+    while (!fill.empty())
+    {
+        const std::size_t current = fill.back();
+        fill.pop_back();
+
+        neighbors.clear();
+        GetNeighbors(m_grid[current], neighbors);
+
+        for (const TTNode& next : neighbors)
+        {
+            const std::size_t index = GetNodeIndex(next);
+            if (m_components[index] == previous)
+            {
+                m_components[index] = label;
+                fill.push_back(index);
+            }
+        }
+    }
 }
 
 /// \brief  Tells if the node is valid or node
 /// \param  x The X coordinate of the node
 /// \param  y The Y coordinate of the node
 /// \return True or false
-template <typename CoordinateType, typename PriorityType>
-inline bool TSquareGrid<CoordinateType, PriorityType>::IsValidNode(CoordinateType x, CoordinateType y) const
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline bool TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::IsValidNode(CoordinateType x, CoordinateType y) const
 {
     return (x >= 0 && x < m_width && y >= 0 && y < m_height);
 }
 
+/// \brief  Returns the number of bytes used by the grid
+/// \return The size of the grid and of its buffers
+template <typename CoordinateType, typename PriorityType, typename Moves, typename Layout>
+inline std::size_t TSquareGrid<CoordinateType, PriorityType, Moves, Layout>::GetMemoryUsage() const
+{
+    return sizeof(*this)
+         + m_grid.capacity()            * sizeof(TTNode)
+         + m_costs.capacity()
+         + m_node_epochs.capacity()     * sizeof(std::uint32_t)
+         + m_components.capacity()      * sizeof(std::uint32_t)
+         + m_component_sizes.capacity() * sizeof(std::uint32_t)
+         + m_free_labels.capacity()     * sizeof(std::uint32_t)
+         + m_visited.capacity()         * sizeof(std::uint32_t)
+         + (m_fill[0].capacity() + m_fill[1].capacity()) * sizeof(std::size_t)
+         + m_neighbors.capacity()       * sizeof(TTNode);
+}
+
 }
\ No newline at end of file
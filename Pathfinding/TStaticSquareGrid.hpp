@@ -0,0 +1,187 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TStaticSquareGrid.hpp
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef PATHFINDING_T_STATIC_SQUARE_GRID_HPP
+#define PATHFINDING_T_STATIC_SQUARE_GRID_HPP
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <cstdlib>
+#include <type_traits>
+
+#include "TNode.hpp"
+#include "TMoveRules.hpp"
+#include "TMovePolicy.hpp"
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  Returns the row size of a static grid, the next power of two
+///         if it wastes at most a quarter of the row, the width otherwise
+/// \param  width The width of the grid, shared sentinel column included
+/// \param  power The power of two to try
+constexpr std::size_t GetStaticGridStride(std::size_t width, std::size_t power = 1)
+{ return power >= width ? (power - width <= width / 4 ? power : width) : GetStaticGridStride(width, power * 2); }
+
+/// \class  TStaticSquareGrid
+/// \brief  Square grid whose size is known at compile time
+///
+///         Same moves, costs and neighbor order as TSquareGrid, the paths
+///         found on both are the same. The nodes are stored in arrays
+///         with a border of sentinel nodes without neighbors : the moves
+///         toward the border are refused by the sentinel flags, the
+///         neighbors are found without bounds checks. One sentinel column
+///         is shared by the end of a row and the start of the next one,
+///         rows are Width + 1 apart, or a power of two when it wastes at
+///         most a quarter of the row. A width of 2^k - 1 gives a power of
+///         two stride and node indices computed with shifts.
+///
+///         The grid holds all its nodes, allocate large grids on the heap.
+///         Components are computed again by UpdateComponents, until then
+///         IsReachable answers true.
+///
+/// \tparam Width          The width of the grid
+/// \tparam Height         The height of the grid
+/// \tparam CoordinateType The type of the coordinate system, must be signed
+/// \tparam PriorityType   The type of the priority
+/// \tparam Moves          The move policy (see TMovePolicy.hpp)
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves = TFourWayMoves<PriorityType>>
+class TStaticSquareGrid
+{
+public:
+
+    static_assert(std::is_signed<CoordinateType>::value, "TStaticSquareGrid sentinels have negative coordinates");
+    static_assert(Width > 0 && Height > 0, "TStaticSquareGrid can't be empty");
+    static_assert(Width  < static_cast<std::size_t>(std::numeric_limits<CoordinateType>::max()), "TStaticSquareGrid width overflows the coordinates");
+    static_assert(Height < static_cast<std::size_t>(std::numeric_limits<CoordinateType>::max()), "TStaticSquareGrid height overflows the coordinates");
+
+    using TTNode  = TNode<CoordinateType, PriorityType>;
+    using TTMoves = Moves;
+
+    /// \brief  The distance between two rows, the shared sentinel included
+    static constexpr std::size_t STRIDE = GetStaticGridStride(Width + 1);
+
+    /// \brief  The number of stored nodes, sentinels included : a sentinel
+    ///         row above and below, and the last sentinel of the bottom row
+    static constexpr std::size_t SIZE = STRIDE * (Height + 2) + 1;
+
+    /// \brief  Creates a grid whose nodes have no neighbors
+    TStaticSquareGrid();
+
+    /// \brief  Removes all neighbors, sets all costs to 1
+    void Initialize();
+
+    /// \brief  Puts into the current node neighbors all direct neighbors,
+    ///         followed by the diagonal ones if the move policy allows them
+    /// \param  current The node to check
+    /// \param  neighbors The vector of neighbors
+    inline void GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const;
+
+    /// \brief  Returns the cost to move from a node to one of its neighbors
+    inline PriorityType GetCost(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Sets the terrain cost of a node, at least 1
+    inline void SetNodeCost(CoordinateType x, CoordinateType y, unsigned char cost);
+
+    /// \brief  Returns the terrain cost of a node
+    inline unsigned char GetNodeCost(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns a read only reference on a node
+    inline const TTNode & GetNode(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns a read only reference on a node from its index
+    inline const TTNode & GetNodeAt(std::size_t index) const;
+
+    /// \brief  Returns the index of a node, (y + 1) * STRIDE + x + 1
+    inline std::size_t GetNodeIndex(const TTNode& node) const;
+
+    /// \brief  Returns the number of nodes of the grid, sentinels included
+    static constexpr std::size_t GetNodeCount()
+    { return SIZE; }
+
+    /// \brief  Returns the width of the grid
+    static constexpr CoordinateType GetWidth()
+    { return static_cast<CoordinateType>(Width); }
+
+    /// \brief  Returns the height of the grid
+    static constexpr CoordinateType GetHeight()
+    { return static_cast<CoordinateType>(Height); }
+
+    /// \brief  Sets the neighbors of a node, the components must be updated after the edits
+    /// \param  x The X coordinate of the node
+    /// \param  y The Y coordinate of the node
+    /// \param  flag The flag to apply
+    inline void SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag);
+
+    /// \brief  Labels the connected components after edits
+    void UpdateComponents();
+
+    /// \brief  Tells if a path may exist between two nodes,
+    ///         i.e. if they are in the same connected component
+    inline bool IsReachable(const TTNode& from, const TTNode& to) const;
+
+    /// \brief  Returns the connected component label of a node
+    inline std::uint32_t GetComponent(CoordinateType x, CoordinateType y) const;
+
+    /// \brief  Returns the edit epoch, bumped by every edit of the grid
+    inline std::uint32_t GetEpoch() const;
+
+    /// \brief  Returns the epoch of the last edit that may change
+    ///         the moves from or to a node
+    inline std::uint32_t GetNodeEpoch(std::size_t index) const;
+
+    /// \brief  Tells if the node is valid or node
+    static constexpr bool IsValidNode(CoordinateType x, CoordinateType y)
+    { return x >= 0 && x < GetWidth() && y >= 0 && y < GetHeight(); }
+
+    /// \brief  Returns the number of bytes used by the grid
+    static constexpr std::size_t GetMemoryUsage()
+    { return sizeof(TStaticSquareGrid); }
+
+private:
+
+    using TTMoveRules = TMoveRules<TTNode, Moves>;
+
+    /// \brief  Returns the index of a node from its coordinates, x and y
+    ///         may be one step outside of the grid
+    static constexpr std::size_t GetIndex(int x, int y)
+    { return static_cast<std::size_t>(y + 1) * STRIDE + static_cast<std::size_t>(x + 1); }
+
+    /// \brief  Bumps the epoch and stamps the nodes whose moves may change
+    inline void Touch(CoordinateType x, CoordinateType y, int radius);
+
+    std::array<TTNode,        SIZE> m_grid;                  ///< The nodes and the sentinels
+    std::array<unsigned char, SIZE> m_costs;                 ///< The terrain cost of each node
+    std::array<std::uint32_t, SIZE> m_components;            ///< The component label of each node
+    std::array<std::uint32_t, SIZE> m_node_epochs;           ///< The last epoch touching each node
+    std::uint32_t                   m_epoch = 0;             ///< The edit epoch
+    bool                            m_dirty = true;          ///< Edited since UpdateComponents
+};
+
+} // !namespace nav
+
+#include "TStaticSquareGrid.inl"
+
+#endif // PATHFINDING_T_STATIC_SQUARE_GRID_HPP
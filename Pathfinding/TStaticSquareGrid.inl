@@ -0,0 +1,212 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TStaticSquareGrid.inl
+/// \date       18/10/2026
+/// \project    Pathfinding
+/// \author     Vincent STEHLY--CALISTO
+
+#include <algorithm>
+
+/// \namespace nav
+namespace nav
+{
+
+/// \brief  Creates a grid whose nodes have no neighbors
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::TStaticSquareGrid()
+{
+    Initialize();
+}
+
+/// \brief  Removes all neighbors, sets all costs to 1
+///         Sentinels and padding nodes keep their coordinates,
+///         GetNodeAt stays consistent with GetNodeIndex
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+void TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::Initialize()
+{
+    // A shared sentinel is stored as the start of the next row
+    for (std::size_t index = 0; index < SIZE; ++index)
+    {
+        m_grid[index] = TTNode(static_cast<CoordinateType>(static_cast<int>(index % STRIDE) - 1),
+                               static_cast<CoordinateType>(static_cast<int>(index / STRIDE) - 1));
+    }
+
+    m_costs.fill(1);
+
+    // A new grid, everything cached on the previous one is stale
+    ++m_epoch;
+    m_node_epochs.fill(m_epoch);
+
+    UpdateComponents();
+}
+
+/// \brief  Puts into the current node neighbors all direct neighbors,
+///         followed by the diagonal ones if the move policy allows them
+///         Moves toward the border are refused by the sentinel flags
+/// \param  current The node to check
+/// \param  neighbors The vector of neighbors
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline void TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetNeighbors(const TTNode& current, std::vector < TTNode >& neighbors) const
+{
+    // Neighbors of inner nodes are inner nodes or sentinels, no bound check
+    TTMoveRules::GetNeighbors(current.X(), current.Y(), m_grid[GetIndex(current.X(), current.Y())].GetNeighborFlags(),
+        [this](int x, int y) -> unsigned char
+        { return m_grid[GetIndex(x, y)].GetNeighborFlags(); },
+        [this](int x, int y, unsigned char /* flags */) -> const TTNode&
+        { return m_grid[GetIndex(x, y)]; },
+        neighbors);
+}
+
+/// \brief  Returns the cost to move from a node to one of its neighbors
+///         The terrain cost of the neighbor scaled by the move length
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline PriorityType TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetCost(const TTNode& from, const TTNode& to) const
+{
+    const PriorityType cost = m_costs[GetNodeIndex(to)];
+
+    if (Moves::DIAGONAL && from.X() != to.X() && from.Y() != to.Y())
+        return cost * Moves::DIAGONAL_COST;
+
+    return cost * Moves::STRAIGHT_COST;
+}
+
+/// \brief  Sets the terrain cost of a node, a free node would
+///         break the admissibility of the heuristics
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline void TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::SetNodeCost(CoordinateType x, CoordinateType y, unsigned char cost)
+{
+    m_costs[GetIndex(x, y)] = std::max<unsigned char>(cost, 1);
+    Touch(x, y, 0);
+}
+
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline unsigned char TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetNodeCost(CoordinateType x, CoordinateType y) const
+{ return m_costs[GetIndex(x, y)]; }
+
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline const TNode<CoordinateType, PriorityType>& TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetNode(CoordinateType x, CoordinateType y) const
+{ return m_grid[GetIndex(x, y)]; }
+
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline const TNode<CoordinateType, PriorityType>& TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetNodeAt(std::size_t index) const
+{ return m_grid[index]; }
+
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline std::size_t TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetNodeIndex(const TTNode& node) const
+{ return GetIndex(node.X(), node.Y()); }
+
+/// \brief  Sets the neighbors of a node
+///         The components are stale until UpdateComponents
+/// \param  x The X coordinate of the node
+/// \param  y The Y coordinate of the node
+/// \param  flag The flag to apply
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline void TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::SetNodeNeighbors(CoordinateType x, CoordinateType y, unsigned char flag)
+{
+    m_grid[GetIndex(x, y)].SetNeighborFlag(flag);
+
+    // The node is the corner of the diagonal moves around it
+    Touch(x, y, 1);
+    m_dirty = true;
+}
+
+/// \brief  Labels the connected components after edits
+///         Each component takes the index of its first node as label
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+void TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::UpdateComponents()
+{
+    std::vector<std::size_t> fill;
+    std::vector<TTNode>      neighbors;
+
+    for (std::size_t index = 0; index < SIZE; ++index)
+        m_components[index] = static_cast<std::uint32_t>(index);
+
+    // Flooded through all moves, diagonal ones included (see TMovePolicy.hpp)
+    std::vector<bool> visited(SIZE, false);
+    for (std::size_t nRow = 0; nRow < Height; ++nRow)
+    {
+        for (std::size_t nCol = 0; nCol < Width; ++nCol)
+        {
+            const std::size_t seed = GetIndex(static_cast<int>(nCol), static_cast<int>(nRow));
+            if (visited[seed])
+                continue;
+
+            visited[seed] = true;
+            fill.assign(1, seed);
+
+            while (!fill.empty())
+            {
+                const std::size_t current = fill.back();
+                fill.pop_back();
+                m_components[current] = static_cast<std::uint32_t>(seed);
+
+                neighbors.clear();
+                GetNeighbors(m_grid[current], neighbors);
+
+                for (const TTNode& next : neighbors)
+                {
+                    const std::size_t index = GetNodeIndex(next);
+                    if (!visited[index])
+                    {
+                        visited[index] = true;
+                        fill.push_back(index);
+                    }
+                }
+            }
+        }
+    }
+
+    m_dirty = false;
+}
+
+/// \brief  Tells if a path may exist between two nodes
+///         Stale components can't prove anything, the search decides
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline bool TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::IsReachable(const TTNode& from, const TTNode& to) const
+{ return m_dirty || m_components[GetNodeIndex(from)] == m_components[GetNodeIndex(to)]; }
+
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetComponent(CoordinateType x, CoordinateType y) const
+{ return m_components[GetIndex(x, y)]; }
+
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetEpoch() const
+{ return m_epoch; }
+
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline std::uint32_t TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::GetNodeEpoch(std::size_t index) const
+{ return m_node_epochs[index]; }
+
+/// \brief  Bumps the epoch and stamps the nodes whose moves may change
+///         The border keeps the stamps inside the arrays
+/// \param  x The X coordinate of the edited node
+/// \param  y The Y coordinate of the edited node
+/// \param  radius 1 to stamp the 8 nodes around too, 0 otherwise
+template <std::size_t Width, std::size_t Height, typename CoordinateType, typename PriorityType, typename Moves>
+inline void TStaticSquareGrid<Width, Height, CoordinateType, PriorityType, Moves>::Touch(CoordinateType x, CoordinateType y, int radius)
+{
+    ++m_epoch;
+
+    for (int ny = y - radius; ny <= y + radius; ++ny)
+    {
+        for (int nx = x - radius; nx <= x + radius; ++nx)
+            m_node_epochs[GetIndex(nx, ny)] = m_epoch;
+    }
+}
+
+} // !namespace nav
@@ -0,0 +1,215 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+/// See https://vincentcalisto.com/
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file    CDoubleEndedStackAllocator.cpp
+/// \date    18/10/2026
+/// \project Articles
+/// \author  Vincent STEHLY--CALISTO
+
+#include "CDoubleEndedStackAllocator.hpp"
+
+/// \brief Destructor
+CDoubleEndedStackAllocator::~CDoubleEndedStackAllocator()
+{
+    Release(); // RAII idiom
+}
+
+/// \brief  Initializes the allocator by allocating size bytes
+/// \param  size The amount of memory (in bytes) to allocate
+void CDoubleEndedStackAllocator::Initialize(std::size_t size)
+{
+    // Same limits as CStackAllocator
+    if(size == 0 || size >= 1024 * 1024 * 64)
+    {
+        throw std::bad_alloc();
+    }
+
+    // Avoid memory leak
+    Release();
+
+    m_size          = size;
+    m_heads[BOTTOM] = 0;
+    m_heads[TOP]    = m_size;
+    mp_data         = new uint8_t[m_size];
+}
+
+/// \brief Releases the allocator memory
+void CDoubleEndedStackAllocator::Release()
+{
+    Unwind(BOTTOM, 0);
+    Unwind(TOP,    m_size);
+    delete[] mp_data;
+
+    m_size          = 0;
+    m_heads[BOTTOM] = 0;
+    m_heads[TOP]    = 0;
+    mp_data         = nullptr;
+}
+
+/// \brief  Destroys the objects of both ends and resets both heads
+void CDoubleEndedStackAllocator::Clear()
+{
+    Clear(TOP);
+    Clear(BOTTOM);
+}
+
+/// \brief  Destroys the objects of one end and resets its head
+/// \param  end The end to clear
+void CDoubleEndedStackAllocator::Clear(EEnd end)
+{
+    RollBack(end, end == BOTTOM ? 0 : m_size);
+}
+
+/// \brief  Destroys the objects allocated at one end since a marker
+///         and moves the head of this end back to it
+/// \param  end The end to roll back
+/// \param  marker A head returned by GetHead for the same end
+void CDoubleEndedStackAllocator::RollBack(EEnd end, std::size_t marker)
+{
+    const bool valid = end == BOTTOM ? marker <= m_heads[BOTTOM]
+                                     : marker >= m_heads[TOP] && marker <= m_size;
+    if(!valid)
+    {
+        throw std::invalid_argument("CDoubleEndedStackAllocator : can't roll back past the head");
+    }
+
+    Unwind(end, marker);
+    m_heads[end] = marker;
+}
+
+/// \brief  Allocates size bytes at one end of the buffer
+///         and returns a pointer on the allocated memory
+///         Moves the head of the end past the padding and the block
+/// \param  end The end to allocate from
+/// \param  size The amount of bytes to allocate
+/// \param  alignment The alignment of the block, a power of two
+/// \return A pointer on the allocated memory
+void* CDoubleEndedStackAllocator::Allocate(EEnd end, std::size_t size, std::size_t alignment)
+{
+    if(size == 0)
+    {
+        throw std::bad_alloc();
+    }
+
+    return Reserve(end, size, alignment);
+}
+
+/// \brief  Allocates size bytes at one end of the buffer,
+///         an empty block gives the aligned head
+/// \param  end The end to allocate from
+/// \param  size The amount of bytes to allocate, may be 0
+/// \param  alignment The alignment of the block, a power of two
+/// \return A pointer on the allocated memory
+void* CDoubleEndedStackAllocator::Reserve(EEnd end, std::size_t size, std::size_t alignment)
+{
+    if(alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        throw std::invalid_argument("CDoubleEndedStackAllocator : the alignment must be a power of two");
+    }
+
+    const std::size_t free = GetFree();
+    if(!mp_data || size > free)
+    {
+        throw std::bad_alloc();
+    }
+
+    // The address is aligned, not the offset, the buffer may be less aligned
+    const std::size_t mask = alignment - 1;
+
+    if(end == BOTTOM)
+    {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mp_data + m_heads[BOTTOM]);
+        const std::size_t    padding = static_cast<std::size_t>((alignment - (address & mask)) & mask);
+
+        if(padding > free - size)
+        {
+            throw std::bad_alloc();
+        }
+
+        void* pointer = mp_data + m_heads[BOTTOM] + padding;
+        m_heads[BOTTOM] += padding + size;
+
+        return pointer;
+    }
+
+    // The top grows down, the block is aligned by moving it further down
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mp_data + m_heads[TOP] - size);
+    const std::size_t    padding = static_cast<std::size_t>(address & mask);
+
+    if(padding > free - size)
+    {
+        throw std::bad_alloc();
+    }
+
+    m_heads[TOP] -= size + padding;
+
+    return mp_data + m_heads[TOP];
+}
+
+/// \brief  Returns the amount of allocated memory of the allocator
+/// \return The amount of allocated memory in bytes
+std::size_t CDoubleEndedStackAllocator::GetSize() const
+{
+    return m_size;
+}
+
+/// \brief  Returns the head of one end as an offset in bytes
+///         from the start of the buffer
+/// \param  end The end
+/// \return The head of the end, GetSize() for an empty top
+std::size_t CDoubleEndedStackAllocator::GetHead(EEnd end) const
+{
+    return m_heads[end];
+}
+
+/// \brief  Returns the amount of memory left between both ends
+/// \return The free memory in bytes
+std::size_t CDoubleEndedStackAllocator::GetFree() const
+{
+    return m_heads[TOP] - m_heads[BOTTOM];
+}
+
+/// \brief  Returns a read only pointer on the data
+/// \return A read only pointer on the data
+const uint8_t* CDoubleEndedStackAllocator::GetData() const
+{
+    return mp_data;
+}
+
+/// \brief  Destroys the objects of one end allocated past a marker
+///         The chain of each end goes toward the end of the buffer
+/// \param  end The end to unwind
+/// \param  marker The head to unwind to
+void CDoubleEndedStackAllocator::Unwind(EEnd end, std::size_t marker)
+{
+    const uint8_t* p_marker = mp_data + marker;
+
+    while(mp_destructors[end])
+    {
+        SStackDestructor* p_destructor = mp_destructors[end];
+        const uint8_t*    p_address    = reinterpret_cast<uint8_t*>(p_destructor);
+
+        if(end == BOTTOM ? p_address < p_marker : p_address >= p_marker)
+        {
+            break;
+        }
+
+        mp_destructors[end] = p_destructor->p_next;
+        p_destructor->destroy(p_destructor->p_objects, p_destructor->count);
+    }
+}
@@ -0,0 +1,196 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+/// See https://vincentcalisto.com/
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file    CDoubleEndedStackAllocator.hpp
+/// \date    18/10/2026
+/// \project Articles
+/// \author  Vincent STEHLY--CALISTO
+
+#ifndef ARTICLES_C_DOUBLE_ENDED_STACK_ALLOCATOR_HPP__
+#define ARTICLES_C_DOUBLE_ENDED_STACK_ALLOCATOR_HPP__
+
+#include <utility>   ///< std::forward
+#include <cstddef>   ///< std::size_t
+#include <cstdint>   ///< uint8_t
+#include <stdexcept> ///< std::bad_alloc
+
+#include "SStackObjects.hpp"
+
+/// \class CDoubleEndedStackAllocator
+/// \brief Two stacks sharing one buffer, one grows up from the bottom,
+///        the other grows down from the top
+///
+///        Memory with different lifetimes shares one arena, e.g. the
+///        level data at the bottom and the frame scratch at the top.
+///        The buffer is full only when both ends meet. Each end has its
+///        own markers and destructor chain, see CStackAllocator.
+class CDoubleEndedStackAllocator
+{
+public:
+
+    /// \brief The ends of the buffer
+    enum EEnd
+    {
+        BOTTOM = 0, ///< Grows up from the start of the buffer
+        TOP    = 1  ///< Grows down from the end of the buffer
+    };
+
+    /// \brief Default constructor
+    CDoubleEndedStackAllocator() = default;
+
+    /// \brief Destructor
+    ~CDoubleEndedStackAllocator();
+
+    /// \brief  Initializes the allocator by allocating size bytes
+    /// \param  size The amount of memory (in bytes) to allocate
+    void Initialize(std::size_t size);
+
+    /// \brief Releases the allocator memory
+    void Release();
+
+    /// \brief  Destroys the objects of both ends and resets both heads
+    void Clear();
+
+    /// \brief  Destroys the objects of one end and resets its head
+    /// \param  end The end to clear
+    void Clear(EEnd end);
+
+    /// \brief  Destroys the objects allocated at one end since a marker
+    ///         and moves the head of this end back to it
+    /// \param  end The end to roll back
+    /// \param  marker A head returned by GetHead for the same end
+    void RollBack(EEnd end, std::size_t marker);
+
+    /// \brief  Allocates size bytes at one end of the buffer
+    ///         and returns a pointer on the allocated memory
+    /// \param  end The end to allocate from
+    /// \param  size The amount of bytes to allocate
+    /// \param  alignment The alignment of the block, a power of two
+    /// \return A pointer on the allocated memory
+    void * Allocate(EEnd end, std::size_t size, std::size_t alignment = 1);
+
+    /// \brief  Constructs an object at one end of the buffer
+    /// \param  end The end to allocate from
+    /// \param  args The arguments of the constructor
+    /// \return A pointer on the object
+    template <typename T, typename... Args>
+    T * New(EEnd end, Args&&... args);
+
+    /// \brief  Default constructs count objects at one end of the buffer
+    /// \param  end The end to allocate from
+    /// \param  count The number of objects, may be 0 like new T[0]
+    /// \return A pointer on the first object
+    template <typename T>
+    T * NewArray(EEnd end, std::size_t count);
+
+    /// \brief  Returns the amount of allocated memory of the allocator
+    /// \return The amount of allocated memory in bytes
+    std::size_t GetSize() const;
+
+    /// \brief  Returns the head of one end as an offset in bytes
+    ///         from the start of the buffer
+    /// \param  end The end
+    /// \return The head of the end, GetSize() for an empty top
+    std::size_t GetHead(EEnd end) const;
+
+    /// \brief  Returns the amount of memory left between both ends
+    /// \return The free memory in bytes
+    std::size_t GetFree() const;
+
+    /// \brief  Returns a read only pointer on the data
+    /// \return A read only pointer on the data
+    const uint8_t * GetData() const;
+
+private:
+
+    /// \brief One end seen as a stack, see SStackObjects
+    struct SEnd
+    {
+        CDoubleEndedStackAllocator& allocator; ///< The allocator
+        EEnd                        end;       ///< The end
+
+        void * Reserve(std::size_t size, std::size_t alignment)
+        { return allocator.Reserve(end, size, alignment); }
+
+        std::size_t GetHead() const
+        { return allocator.GetHead(end); }
+
+        void RollBack(std::size_t marker)
+        { allocator.RollBack(end, marker); }
+
+        SStackDestructor *& GetDestructors()
+        { return allocator.mp_destructors[end]; }
+    };
+
+    /// \brief  Allocates size bytes at one end of the buffer,
+    ///         an empty block gives the aligned head
+    /// \param  end The end to allocate from
+    /// \param  size The amount of bytes to allocate, may be 0
+    /// \param  alignment The alignment of the block, a power of two
+    /// \return A pointer on the allocated memory
+    void * Reserve(EEnd end, std::size_t size, std::size_t alignment);
+
+    /// \brief  Destroys the objects of one end allocated past a marker
+    /// \param  end The end to unwind
+    /// \param  marker The head to unwind to
+    void Unwind(EEnd end, std::size_t marker);
+
+    std::size_t        m_size            = 0;                    ///< The size in bytes of the allocator
+    std::size_t        m_heads[2]        = { 0, 0 };             ///< The heads of both ends
+    uint8_t *          mp_data           = nullptr;              ///< The memory buffer
+    SStackDestructor * mp_destructors[2] = { nullptr, nullptr }; ///< The last linked destructor of both ends
+};
+
+/// \class CDoubleEndedStackScope
+/// \brief Rolls one end of a double ended allocator back to its head
+///        at construction when the scope ends
+class CDoubleEndedStackScope
+{
+public:
+
+    /// \brief Saves the head of one end of the allocator
+    CDoubleEndedStackScope(CDoubleEndedStackAllocator& allocator, CDoubleEndedStackAllocator::EEnd end)
+    : m_allocator(allocator)
+    , m_end      (end)
+    , m_marker   (allocator.GetHead(end))
+    { /* None */ }
+
+    /// \brief Rolls back, unless the end was cleared past the marker
+    ~CDoubleEndedStackScope()
+    {
+        const std::size_t head = m_allocator.GetHead(m_end);
+
+        if(m_end == CDoubleEndedStackAllocator::BOTTOM ? m_marker <= head : m_marker >= head)
+        {
+            m_allocator.RollBack(m_end, m_marker);
+        }
+    }
+
+    CDoubleEndedStackScope(const CDoubleEndedStackScope&)            = delete;
+    CDoubleEndedStackScope& operator=(const CDoubleEndedStackScope&) = delete;
+
+private:
+
+    CDoubleEndedStackAllocator&      m_allocator; ///< The allocator to roll back
+    CDoubleEndedStackAllocator::EEnd m_end;       ///< The end to roll back
+    std::size_t                      m_marker;    ///< The head at construction
+};
+
+#include "CDoubleEndedStackAllocator.inl"
+
+#endif // !ARTICLES_C_DOUBLE_ENDED_STACK_ALLOCATOR_HPP__
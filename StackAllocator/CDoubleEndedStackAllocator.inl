@@ -0,0 +1,46 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+/// See https://vincentcalisto.com/
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file    CDoubleEndedStackAllocator.inl
+/// \date    18/10/2026
+/// \project Articles
+/// \author  Vincent STEHLY--CALISTO
+
+/// \brief  Constructs an object at one end of the buffer
+///         The end is left untouched if the constructor throws
+/// \param  end The end to allocate from
+/// \param  args The arguments of the constructor
+/// \return A pointer on the object
+template <typename T, typename... Args>
+T* CDoubleEndedStackAllocator::New(EEnd end, Args&&... args)
+{
+    SEnd stack { *this, end };
+    return SStackObjects::New<T>(stack, std::forward<Args>(args)...);
+}
+
+/// \brief  Default constructs count objects at one end of the buffer
+///         The end is left untouched if a constructor throws
+/// \param  end The end to allocate from
+/// \param  count The number of objects, may be 0 like new T[0]
+/// \return A pointer on the first object
+template <typename T>
+T* CDoubleEndedStackAllocator::NewArray(EEnd end, std::size_t count)
+{
+    SEnd stack { *this, end };
+    return SStackObjects::NewArray<T>(stack, count);
+}
@@ -56,6 +56,7 @@ void CStackAllocator::Initialize(std::size_t size)
 /// \brief Releases the allocator memory
 void CStackAllocator::Release()
 {
+    Unwind(0);
     delete[] mp_data;
 
     m_head  = 0;
@@ -63,26 +64,71 @@ void CStackAllocator::Release()
     mp_data = nullptr;
 }
 
-/// \brief  Resets the head
+/// \brief  Destroys the objects of the chain and resets the head
 void CStackAllocator::Clear()
 {
+    Unwind(0);
     m_head = 0;
 }
 
+/// \brief  Destroys the objects allocated since a marker
+///         and moves the head back to it
+/// \param  marker A head returned by GetHead, at most the current head
+void CStackAllocator::RollBack(std::size_t marker)
+{
+    if(marker > m_head)
+    {
+        throw std::invalid_argument("CStackAllocator : can't roll back above the head");
+    }
+
+    Unwind(marker);
+    m_head = marker;
+}
+
 /// \brief  Allocates size bytes at the top of the stack
 ///         and returns a pointer on the allocated memory
-///         Moves the head of the stack to m_head + size
+///         Moves the head of the stack past the padding and the block
 /// \param  size The amount of bytes to allocate
+/// \param  alignment The alignment of the block, a power of two
+/// \return A pointer on the allocated memory
+void* CStackAllocator::Allocate(std::size_t size, std::size_t alignment)
+{
+    if(size == 0)
+    {
+        throw std::bad_alloc();
+    }
+
+    return Reserve(size, alignment);
+}
+
+/// \brief  Allocates size bytes at the top of the stack,
+///         an empty block gives the aligned head
+/// \param  size The amount of bytes to allocate, may be 0
+/// \param  alignment The alignment of the block, a power of two
 /// \return A pointer on the allocated memory
-void* CStackAllocator::Allocate(std::size_t size)
+void* CStackAllocator::Reserve(std::size_t size, std::size_t alignment)
 {
-    if(m_head + size >= m_size || !mp_data || size == 0)
+    if(alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        throw std::invalid_argument("CStackAllocator : the alignment must be a power of two");
+    }
+
+    if(!mp_data)
+    {
+        throw std::bad_alloc();
+    }
+
+    // The address is aligned, not the offset, the buffer may be less aligned
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mp_data + m_head);
+    const std::size_t    padding = static_cast<std::size_t>((alignment - (address & (alignment - 1))) & (alignment - 1));
+
+    if(padding > m_size - m_head || size > m_size - m_head - padding)
     {
         throw std::bad_alloc();
     }
 
-    void* pointer = mp_data + m_head;
-    m_head += size;
+    void* pointer = mp_data + m_head + padding;
+    m_head += padding + size;
 
     return pointer;
 }
@@ -107,3 +153,25 @@ const uint8_t* CStackAllocator::GetData() const
 {
     return mp_data;
 }
+
+/// \brief  Returns the last linked destructor, see SStackObjects
+/// \return A reference on the head of the destructor chain
+SStackDestructor*& CStackAllocator::GetDestructors()
+{
+    return mp_destructors;
+}
+
+/// \brief  Destroys the objects of the chain above an offset
+///         Destructors are stored before their objects,
+///         the chain goes down the stack
+/// \param  head The offset to unwind to
+void CStackAllocator::Unwind(std::size_t head)
+{
+    while(mp_destructors && reinterpret_cast<uint8_t*>(mp_destructors) >= mp_data + head)
+    {
+        SStackDestructor* p_destructor = mp_destructors;
+        mp_destructors = p_destructor->p_next;
+
+        p_destructor->destroy(p_destructor->p_objects, p_destructor->count);
+    }
+}
@@ -24,12 +24,21 @@
 #ifndef ARTICLES_C_STACK_ALLOCATOR_HPP__
 #define ARTICLES_C_STACK_ALLOCATOR_HPP__
 
+#include <utility>   ///< std::forward
 #include <cstddef>   ///< std::size_t
 #include <cstdint>   ///< uint8_t
 #include <stdexcept> ///< std::bad_alloc
 
+#include "SStackObjects.hpp"
+
 /// \class StackAllocator
 /// \brief Simple stack allocator
+///
+///        Objects built with New or NewArray are constructed in place.
+///        Trivially destructible ones cost nothing more than their
+///        memory, the other ones are pushed on a destructor chain
+///        stored in the stack itself and destroyed by Clear or Release,
+///        the last built first.
 class CStackAllocator
 {
 public:
@@ -47,15 +56,33 @@ public:
     /// \brief Releases the allocator memory
     void Release();
 
-    /// \brief  Resets the head
+    /// \brief  Destroys the objects of the chain and resets the head
     void Clear();
 
+    /// \brief  Destroys the objects allocated since a marker
+    ///         and moves the head back to it
+    /// \param  marker A head returned by GetHead, at most the current head
+    void RollBack(std::size_t marker);
+
     /// \brief  Allocates size bytes at the top of the stack
     ///         and returns a pointer on the allocated memory
-    ///         Moves the head of the stack to m_head + size
+    ///         Moves the head of the stack past the padding and the block
     /// \param  size The amount of bytes to allocate
+    /// \param  alignment The alignment of the block, a power of two
     /// \return A pointer on the allocated memory
-    void * Allocate(std::size_t size);
+    void * Allocate(std::size_t size, std::size_t alignment = 1);
+
+    /// \brief  Constructs an object at the top of the stack
+    /// \param  args The arguments of the constructor
+    /// \return A pointer on the object
+    template <typename T, typename... Args>
+    T * New(Args&&... args);
+
+    /// \brief  Default constructs count objects at the top of the stack
+    /// \param  count The number of objects, may be 0 like new T[0]
+    /// \return A pointer on the first object
+    template <typename T>
+    T * NewArray(std::size_t count);
 
     /// \brief  Returns the amount of allocated memory of the allocator
     /// \return The amount of allocated memory in bytes
@@ -71,11 +98,63 @@ public:
 
 private:
 
-    std::size_t  m_size  = 0;       ///< The size in bytes of the allocator
-    std::size_t  m_head  = 0;       ///< The current position in the stack
-    uint8_t *    mp_data = nullptr; ///< The memory buffer
+    friend struct SStackObjects;
+
+    /// \brief  Allocates size bytes at the top of the stack,
+    ///         an empty block gives the aligned head
+    /// \param  size The amount of bytes to allocate, may be 0
+    /// \param  alignment The alignment of the block, a power of two
+    /// \return A pointer on the allocated memory
+    void * Reserve(std::size_t size, std::size_t alignment);
+
+    /// \brief  Returns the last linked destructor, see SStackObjects
+    /// \return A reference on the head of the destructor chain
+    SStackDestructor *& GetDestructors();
+
+    /// \brief  Destroys the objects of the chain above an offset
+    /// \param  head The offset to unwind to
+    void Unwind(std::size_t head);
+
+    std::size_t        m_size         = 0;       ///< The size in bytes of the allocator
+    std::size_t        m_head         = 0;       ///< The current position in the stack
+    uint8_t *          mp_data        = nullptr; ///< The memory buffer
+    SStackDestructor * mp_destructors = nullptr; ///< The last linked destructor
 };
 
 using CFrameAllocator = CStackAllocator; ///< This is also a frame allocator
 
+/// \class CStackScope
+/// \brief Rolls a stack allocator back to its head at construction
+///        when the scope ends, the temporaries of the scope are freed
+///        without waiting for the end of the frame
+class CStackScope
+{
+public:
+
+    /// \brief Saves the head of the allocator
+    explicit CStackScope(CStackAllocator& allocator)
+    : m_allocator(allocator)
+    , m_marker   (allocator.GetHead())
+    { /* None */ }
+
+    /// \brief Rolls back, unless the allocator was cleared below the marker
+    ~CStackScope()
+    {
+        if(m_marker <= m_allocator.GetHead())
+        {
+            m_allocator.RollBack(m_marker);
+        }
+    }
+
+    CStackScope(const CStackScope&)            = delete;
+    CStackScope& operator=(const CStackScope&) = delete;
+
+private:
+
+    CStackAllocator& m_allocator; ///< The allocator to roll back
+    std::size_t      m_marker;    ///< The head at construction
+};
+
+#include "CStackAllocator.inl"
+
 #endif // !ARTICLES_C_STACK_ALLOCATOR_HPP__
\ No newline at end of file
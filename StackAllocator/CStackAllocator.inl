@@ -0,0 +1,42 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+/// See https://vincentcalisto.com/
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file    CStackAllocator.inl
+/// \date    18/10/2026
+/// \project Articles
+/// \author  Vincent STEHLY--CALISTO
+
+/// \brief  Constructs an object at the top of the stack
+///         The stack is left untouched if the constructor throws
+/// \param  args The arguments of the constructor
+/// \return A pointer on the object
+template <typename T, typename... Args>
+T* CStackAllocator::New(Args&&... args)
+{
+    return SStackObjects::New<T>(*this, std::forward<Args>(args)...);
+}
+
+/// \brief  Default constructs count objects at the top of the stack
+///         The stack is left untouched if a constructor throws
+/// \param  count The number of objects, may be 0 like new T[0]
+/// \return A pointer on the first object
+template <typename T>
+T* CStackAllocator::NewArray(std::size_t count)
+{
+    return SStackObjects::NewArray<T>(*this, count);
+}
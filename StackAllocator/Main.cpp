@@ -21,7 +21,11 @@
 /// \project Articles
 /// \author  Vincent STEHLY--CALISTO
 
+#include <string>
+#include <cstring>
+
 #include "CStackAllocator.hpp"
+#include "CDoubleEndedStackAllocator.hpp"
 
 int main()
 {
@@ -32,6 +36,33 @@ int main()
     // Frame begin
     // Allocating 512 raw bytes
     void* p_data = frame_allocator.Allocate(512);
+    std::memset(p_data, 0, 512);
+
+    // Allocating 64 bytes aligned for AVX
+    void* p_vector = frame_allocator.Allocate(64, 32);
+    std::memset(p_vector, 0, 64);
+
+    // Constructing objects in place
+    // Trivially destructible, nothing is recorded for them
+    double* p_values = frame_allocator.NewArray<double>(16);
+    int*    p_count  = frame_allocator.New<int>(16);
+
+    for(int index = 0; index < *p_count; ++index)
+    {
+        p_values[index] = index * 0.5;
+    }
+
+    // Its destructor runs when the stack is cleared
+    std::string* p_name = frame_allocator.New<std::string>("frame");
+    p_name->append("_begin");
+
+    {
+        // Temporaries of a nested scope
+        // Freed when the scope ends, not at the end of the frame
+        CStackScope scope(frame_allocator);
+        void* p_temporary = frame_allocator.Allocate(128);
+        std::memset(p_temporary, 0, 128);
+    }
 
     // Frame end
     // Clearing the stack
@@ -41,5 +72,17 @@ int main()
     // Releasing manually the memory
     frame_allocator.Release();
 
+    // Level data at the bottom, frame scratch at the top of the same buffer
+    CDoubleEndedStackAllocator level_allocator;
+    level_allocator.Initialize(1024);
+
+    void* p_level   = level_allocator.Allocate(CDoubleEndedStackAllocator::BOTTOM, 512);
+    std::memset(p_level, 0, 512);
+    void* p_scratch = level_allocator.Allocate(CDoubleEndedStackAllocator::TOP,    256);
+    std::memcpy(p_scratch, p_level, 256);
+
+    // Frame end, the level data stays
+    level_allocator.Clear(CDoubleEndedStackAllocator::TOP);
+
     return 0;
 }
\ No newline at end of file
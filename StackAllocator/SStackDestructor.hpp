@@ -0,0 +1,61 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+/// See https://vincentcalisto.com/
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file    SStackDestructor.hpp
+/// \date    18/10/2026
+/// \project Articles
+/// \author  Vincent STEHLY--CALISTO
+
+#ifndef ARTICLES_S_STACK_DESTRUCTOR_HPP__
+#define ARTICLES_S_STACK_DESTRUCTOR_HPP__
+
+#include <cstddef> ///< std::size_t
+
+/// \struct SStackDestructor
+/// \brief  Destroys objects constructed in a stack allocator
+///         Stored in the stack itself, beside the objects, and linked
+///         to the destructor of the objects built before them
+struct SStackDestructor
+{
+    void               (*destroy)(void*, std::size_t); ///< Destroys count objects
+    void *               p_objects;                     ///< The first object
+    std::size_t          count;                         ///< The number of objects
+    SStackDestructor *   p_next;                        ///< The previous destructor
+
+    /// \brief  Destroys count objects of type T, the last one first
+    /// \param  p_objects The first object
+    /// \param  count The number of objects
+    template <typename T>
+    static void Destroy(void * p_objects, std::size_t count);
+};
+
+/// \brief  Destroys count objects of type T, the last one first
+/// \param  p_objects The first object
+/// \param  count The number of objects
+template <typename T>
+void SStackDestructor::Destroy(void* p_objects, std::size_t count)
+{
+    T* p_typed = static_cast<T*>(p_objects);
+
+    while(count > 0)
+    {
+        p_typed[--count].~T();
+    }
+}
+
+#endif // !ARTICLES_S_STACK_DESTRUCTOR_HPP__
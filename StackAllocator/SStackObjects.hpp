@@ -0,0 +1,189 @@
+/// Copyright (C) 2018-2019
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+/// See https://vincentcalisto.com/
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file    SStackObjects.hpp
+/// \date    18/10/2026
+/// \project Articles
+/// \author  Vincent STEHLY--CALISTO
+
+#ifndef ARTICLES_S_STACK_OBJECTS_HPP__
+#define ARTICLES_S_STACK_OBJECTS_HPP__
+
+#include <new>         ///< Placement new
+#include <utility>     ///< std::forward
+#include <cstddef>     ///< std::size_t
+#include <cstdint>     ///< SIZE_MAX
+#include <type_traits> ///< std::is_trivially_destructible
+
+#include "SStackDestructor.hpp"
+
+/// \struct SStackObjects
+/// \brief  Constructs objects in place in a stack, shared by the stack
+///         allocators (see CStackAllocator and CDoubleEndedStackAllocator)
+///
+///         A stack provides :
+///         void * Reserve(std::size_t size, std::size_t alignment), size may be 0
+///         std::size_t GetHead() const
+///         void RollBack(std::size_t marker)
+///         SStackDestructor *& GetDestructors()
+///
+///         Trivially destructible types cost nothing more than their
+///         memory, the other ones get a destructor linked to the chain
+///         of the stack. The stack is rolled back if a constructor throws.
+struct SStackObjects
+{
+    /// \brief  Constructs an object at the head of a stack
+    /// \param  stack The stack
+    /// \param  args The arguments of the constructor
+    /// \return A pointer on the object
+    template <typename T, typename Stack, typename... Args>
+    static T * New(Stack& stack, Args&&... args);
+
+    /// \brief  Default constructs count objects at the head of a stack
+    /// \param  stack The stack
+    /// \param  count The number of objects, may be 0 like new T[0]
+    /// \return A pointer on the first object
+    template <typename T, typename Stack>
+    static T * NewArray(Stack& stack, std::size_t count);
+
+private:
+
+    /// \brief  Allocates the destructor of objects of type T
+    /// \param  stack The stack
+    /// \return The destructor, nullptr if T is trivially destructible
+    template <typename T, typename Stack>
+    static SStackDestructor * AllocateDestructor(Stack& stack);
+
+    /// \brief  Links a destructor once its objects are constructed
+    /// \param  stack The stack
+    /// \param  p_destructor The destructor, nullptr if T needs none
+    /// \param  p_objects The first object
+    /// \param  count The number of objects
+    template <typename T, typename Stack>
+    static void LinkDestructor(Stack& stack, SStackDestructor * p_destructor, T * p_objects, std::size_t count);
+};
+
+/// \brief  Constructs an object at the head of a stack
+///         The stack is left untouched if the constructor throws
+/// \param  stack The stack
+/// \param  args The arguments of the constructor
+/// \return A pointer on the object
+template <typename T, typename Stack, typename... Args>
+T* SStackObjects::New(Stack& stack, Args&&... args)
+{
+    const std::size_t head = stack.GetHead();
+
+    try
+    {
+        SStackDestructor* p_destructor = AllocateDestructor<T>(stack);
+        T*                p_object     = new (stack.Reserve(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+        LinkDestructor(stack, p_destructor, p_object, 1);
+        return p_object;
+    }
+    catch(...)
+    {
+        // Nothing is linked yet, only the memory is given back
+        stack.RollBack(head);
+        throw;
+    }
+}
+
+/// \brief  Default constructs count objects at the head of a stack
+///         The stack is left untouched if a constructor throws
+/// \param  stack The stack
+/// \param  count The number of objects, may be 0 like new T[0]
+/// \return A pointer on the first object
+template <typename T, typename Stack>
+T* SStackObjects::NewArray(Stack& stack, std::size_t count)
+{
+    if(count > SIZE_MAX / sizeof(T))
+    {
+        throw std::bad_alloc();
+    }
+
+    // Nothing to build nor to destroy, a valid pointer all the same
+    if(count == 0)
+    {
+        return static_cast<T*>(stack.Reserve(0, alignof(T)));
+    }
+
+    const std::size_t head        = stack.GetHead();
+    std::size_t       constructed = 0;
+    T*                p_objects   = nullptr;
+
+    try
+    {
+        SStackDestructor* p_destructor = AllocateDestructor<T>(stack);
+        p_objects = static_cast<T*>(stack.Reserve(count * sizeof(T), alignof(T)));
+
+        // Default initialization, like new T[count]
+        for(; constructed < count; ++constructed)
+        {
+            new (p_objects + constructed) T;
+        }
+
+        LinkDestructor(stack, p_destructor, p_objects, count);
+        return p_objects;
+    }
+    catch(...)
+    {
+        SStackDestructor::Destroy<T>(p_objects, constructed);
+        stack.RollBack(head);
+        throw;
+    }
+}
+
+/// \brief  Allocates the destructor of objects of type T
+///         Trivially destructible types need no bookkeeping
+/// \param  stack The stack
+/// \return The destructor, nullptr if T is trivially destructible
+template <typename T, typename Stack>
+SStackDestructor* SStackObjects::AllocateDestructor(Stack& stack)
+{
+    if(std::is_trivially_destructible<T>::value)
+    {
+        return nullptr;
+    }
+
+    return static_cast<SStackDestructor*>(stack.Reserve(sizeof(SStackDestructor), alignof(SStackDestructor)));
+}
+
+/// \brief  Links a destructor once its objects are constructed
+/// \param  stack The stack
+/// \param  p_destructor The destructor, nullptr if T needs none
+/// \param  p_objects The first object
+/// \param  count The number of objects
+template <typename T, typename Stack>
+void SStackObjects::LinkDestructor(Stack& stack, SStackDestructor* p_destructor, T* p_objects, std::size_t count)
+{
+    if(std::is_trivially_destructible<T>::value)
+    {
+        return;
+    }
+
+    SStackDestructor*& p_chain = stack.GetDestructors();
+
+    p_destructor->destroy   = &SStackDestructor::Destroy<T>;
+    p_destructor->p_objects = p_objects;
+    p_destructor->count     = count;
+    p_destructor->p_next    = p_chain;
+    p_chain                 = p_destructor;
+}
+
+#endif // !ARTICLES_S_STACK_OBJECTS_HPP__